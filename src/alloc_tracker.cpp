@@ -0,0 +1,185 @@
+#if !defined(ARDUINO)
+#include "alloc_tracker.h"
+
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace lightsaber {
+
+namespace {
+
+    struct Path {
+        char name[AllocTracker::MAX_PATH_LENGTH];
+        AllocStats stats;
+    };
+
+    // in front of every tracked block, keeps the block aligned like malloc()
+    struct alignas(alignof(max_align_t)) Header {
+        size_t size;
+        uint8_t path;
+    };
+
+    // static storage only: the tracker must not allocate itself
+    Path paths[AllocTracker::MAX_PATHS];
+    uint8_t path_count(0);
+    char current[AllocTracker::MAX_PATH_LENGTH];
+    size_t current_length(0);
+
+    uint8_t findPath(const char* name, bool create)
+    {
+        for (uint8_t index = 0; index < path_count; ++index) {
+            if (strcmp(paths[index].name, name) == 0) {
+                return index;
+            }
+        }
+        if (!create
+            || path_count == AllocTracker::MAX_PATHS) {
+            return AllocTracker::MAX_PATHS;
+        }
+        Path& path(paths[path_count]);
+        strncpy(path.name, name, sizeof(path.name) - 1);
+        path.name[sizeof(path.name) - 1] = '\0';
+        memset(&path.stats, 0, sizeof(path.stats));
+        return path_count++;
+    }
+
+    void* allocate(size_t size)
+    {
+        Header* header(static_cast<Header*>(malloc(sizeof(Header) + size)));
+        if (!header) {
+            return nullptr;
+        }
+        header->size = size;
+        header->path = findPath(current, true);
+        if (header->path < AllocTracker::MAX_PATHS) {
+            AllocStats& stats(paths[header->path].stats);
+            ++stats.allocations;
+            stats.bytes += size;
+            stats.live += size;
+            if (stats.live > stats.peak) {
+                stats.peak = stats.live;
+            }
+        }
+        return header + 1;
+    }
+
+    void release(void* pointer)
+    {
+        if (!pointer) {
+            return;
+        }
+        Header* header(static_cast<Header*>(pointer) - 1);
+        // paths dropped by reset() are no longer counted
+        if (header->path < path_count) {
+            AllocStats& stats(paths[header->path].stats);
+            ++stats.frees;
+            stats.live -= header->size;
+        }
+        free(header);
+    }
+
+} // namespace
+
+AllocScope::AllocScope(const char* tag)
+    : m_parent_length(current_length)
+{
+    int written(snprintf(current + current_length, sizeof(current) - current_length,
+        current_length ? "/%s" : "%s", tag));
+    if (written > 0) {
+        current_length += static_cast<size_t>(written);
+        if (current_length >= sizeof(current)) {
+            current_length = sizeof(current) - 1;
+        }
+    }
+}
+
+AllocScope::~AllocScope()
+{
+    current_length = m_parent_length;
+    current[current_length] = '\0';
+}
+
+void AllocTracker::reset()
+{
+    path_count = 0;
+}
+
+AllocStats AllocTracker::stats(const char* path)
+{
+    uint8_t index(findPath(path, false));
+    if (index == MAX_PATHS) {
+        return AllocStats { 0, 0, 0, 0, 0 };
+    }
+    return paths[index].stats;
+}
+
+void AllocTracker::report()
+{
+    for (uint8_t index = 0; index < path_count; ++index) {
+        const AllocStats& stats(paths[index].stats);
+        printf("Alloc: %-32s %6u allocs %6u frees %8llu bytes %8lld live %8lld peak\n",
+            paths[index].name[0] ? paths[index].name : "(no scope)",
+            stats.allocations, stats.frees, static_cast<unsigned long long>(stats.bytes),
+            static_cast<long long>(stats.live), static_cast<long long>(stats.peak));
+    }
+}
+
+} // namespace lightsaber
+
+void* operator new(size_t size)
+{
+    void* pointer(lightsaber::allocate(size));
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return lightsaber::allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return lightsaber::allocate(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    lightsaber::release(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    lightsaber::release(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    lightsaber::release(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept
+{
+    lightsaber::release(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    lightsaber::release(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+    lightsaber::release(pointer);
+}
+
+#endif
@@ -0,0 +1,45 @@
+#pragma once
+#if !defined(ARDUINO)
+#include <stddef.h>
+#include <stdint.h>
+
+namespace lightsaber {
+
+// Host build only: replaces the global operator new/delete and counts heap
+// use per call path. A path is the nesting of the active AllocScope tags,
+// e.g. "shimmer/render"; allocations outside any scope count for "".
+// Not thread safe, the native tests run single threaded.
+//
+struct AllocStats {
+    uint32_t allocations;
+    uint32_t frees;
+    uint64_t bytes; // total requested
+    int64_t live; // allocated and not yet freed
+    int64_t peak;
+};
+
+class AllocScope {
+public:
+    explicit AllocScope(const char* tag);
+    ~AllocScope();
+
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+
+private:
+    size_t m_parent_length;
+};
+
+class AllocTracker {
+public:
+    static const uint8_t MAX_PATHS = 32;
+    static const uint8_t MAX_PATH_LENGTH = 96;
+
+    static void reset();
+    static AllocStats stats(const char* path);
+    static void report();
+};
+
+} // namespace lightsaber
+
+#endif
@@ -0,0 +1,144 @@
+#include "delta_decoder.h"
+
+#include <string.h>
+
+namespace lightsaber {
+
+DeltaDecoder::DeltaDecoder(DeltaSink& sink)
+    : m_sink(sink)
+{
+}
+
+void DeltaDecoder::reset()
+{
+    m_state = State::Header;
+    m_error = nullptr;
+    m_scratch_fill = 0;
+    m_op = 0;
+    m_insert_remaining = 0;
+}
+
+bool DeltaDecoder::write(const uint8_t* data, size_t size)
+{
+    if (m_state == State::Error) {
+        return false;
+    }
+
+    while (size > 0) {
+        if (m_state == State::Insert) {
+            size_t chunk(size < m_insert_remaining ? size : m_insert_remaining);
+            if (!m_sink.insert(data, chunk)) {
+                return fail(nullptr);
+            }
+            data += chunk;
+            size -= chunk;
+            m_insert_remaining -= chunk;
+            if (m_insert_remaining == 0) {
+                m_state = State::OpTag;
+            }
+            continue;
+        }
+
+        uint8_t need(0);
+        switch (m_state) {
+        case State::Header:
+            need = HEADER_SIZE;
+            break;
+        case State::OpTag:
+            need = 1;
+            break;
+        case State::OpArgs:
+            need = (m_op == OP_COPY) ? 8 : 4;
+            break;
+        default:
+            return fail("unexpected data after delta end");
+        }
+
+        size_t chunk(need - m_scratch_fill);
+        if (chunk > size) {
+            chunk = size;
+        }
+        memcpy(m_scratch + m_scratch_fill, data, chunk);
+        m_scratch_fill += chunk;
+        data += chunk;
+        size -= chunk;
+
+        if (m_scratch_fill == need) {
+            m_scratch_fill = 0;
+            if (!runOp()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool DeltaDecoder::isDelta(const uint8_t* data, size_t size)
+{
+    return size >= 4 && memcmp(data, "LSD1", 4) == 0;
+}
+
+bool DeltaDecoder::runOp()
+{
+    switch (m_state) {
+    case State::Header: {
+        if (!isDelta(m_scratch, HEADER_SIZE)) {
+            return fail("not a delta image");
+        }
+        DeltaHeader header;
+        header.source_size = readU32(m_scratch + 4);
+        header.target_size = readU32(m_scratch + 8);
+        memcpy(header.source_md5, m_scratch + 12, 16);
+        memcpy(header.target_md5, m_scratch + 28, 16);
+        if (!m_sink.beginDelta(header)) {
+            return fail(nullptr);
+        }
+        m_state = State::OpTag;
+        return true;
+    }
+
+    case State::OpTag:
+        m_op = m_scratch[0];
+        if (m_op == OP_COPY
+            || m_op == OP_INSERT) {
+            m_state = State::OpArgs;
+        } else if (m_op == OP_END) {
+            m_state = State::End;
+        } else {
+            return fail("bad delta op");
+        }
+        return true;
+
+    case State::OpArgs:
+        if (m_op == OP_COPY) {
+            m_state = State::OpTag;
+            if (!m_sink.copy(readU32(m_scratch), readU32(m_scratch + 4))) {
+                return fail(nullptr);
+            }
+            return true;
+        }
+        m_insert_remaining = readU32(m_scratch);
+        m_state = m_insert_remaining ? State::Insert : State::OpTag;
+        return true;
+
+    default:
+        return fail("unexpected delta state");
+    }
+}
+
+bool DeltaDecoder::fail(const char* error)
+{
+    m_state = State::Error;
+    m_error = error;
+    return false;
+}
+
+uint32_t DeltaDecoder::readU32(const uint8_t* data)
+{
+    return static_cast<uint32_t>(data[0])
+        | (static_cast<uint32_t>(data[1]) << 8)
+        | (static_cast<uint32_t>(data[2]) << 16)
+        | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+} // namespace lightsaber
@@ -0,0 +1,73 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+namespace lightsaber {
+
+// Streaming parser for delta images (format in tools/ota.py). Input may be
+// split at any byte; the ops are handed to a DeltaSink. No ESP dependencies,
+// so it builds natively for the tests in test/test_delta.
+//
+struct DeltaHeader {
+    uint32_t source_size;
+    uint32_t target_size;
+    uint8_t source_md5[16]; // over the source image without its first HEADER_LITERAL bytes
+    uint8_t target_md5[16];
+};
+
+class DeltaSink {
+public:
+    virtual ~DeltaSink() { }
+
+    virtual bool beginDelta(const DeltaHeader& header) = 0;
+    virtual bool copy(uint32_t offset, uint32_t length) = 0;
+    virtual bool insert(const uint8_t* data, size_t size) = 0;
+};
+
+class DeltaDecoder {
+public:
+    static const uint8_t HEADER_SIZE = 44;
+    // image header (flash mode/size) may be patched by the uploader, never copied
+    static const uint8_t HEADER_LITERAL = 16;
+
+    explicit DeltaDecoder(DeltaSink& sink);
+
+    void reset();
+    bool write(const uint8_t* data, size_t size);
+
+    bool finished() const { return m_state == State::End; }
+    // format error, nullptr if the sink failed
+    const char* error() const { return m_error; }
+
+    static bool isDelta(const uint8_t* data, size_t size);
+
+private:
+    enum class State {
+        Header,
+        OpTag,
+        OpArgs,
+        Insert,
+        End,
+        Error
+    };
+
+    static const uint8_t OP_COPY = 'C';
+    static const uint8_t OP_INSERT = 'I';
+    static const uint8_t OP_END = 'E';
+
+    bool runOp();
+    bool fail(const char* error);
+
+    static uint32_t readU32(const uint8_t* data);
+
+    DeltaSink& m_sink;
+
+    State m_state{ State::Header };
+    const char* m_error{ nullptr };
+    uint8_t m_scratch[HEADER_SIZE];
+    uint8_t m_scratch_fill{ 0 };
+    uint8_t m_op{ 0 };
+    uint32_t m_insert_remaining{ 0 };
+};
+
+} // namespace lightsaber
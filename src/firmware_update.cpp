@@ -0,0 +1,295 @@
+#include "firmware_update.h"
+
+namespace lightsaber {
+
+FirmwareUpdate::FirmwareUpdate()
+    : m_server(80)
+    , m_delta(*this)
+{
+}
+
+void FirmwareUpdate::begin()
+{
+    m_server.on(
+        "/update", HTTP_POST,
+        [this]() { handleResult(); },
+        [this]() { handleUpload(); });
+    m_server.begin();
+    Serial.printf("HTTP update: POST /update on port 80\n");
+}
+
+void FirmwareUpdate::loop()
+{
+    m_server.handleClient();
+
+    if (m_restart_at != 0
+        && static_cast<int32_t>(millis() - m_restart_at) >= 0) {
+        ESP.restart();
+    }
+}
+
+void FirmwareUpdate::reset()
+{
+    m_kind = Kind::Unknown;
+    m_failed = false;
+    m_error = String();
+    m_delta.reset();
+    m_start_ms = millis();
+    m_duration_ms = 0;
+    m_payload_bytes = 0;
+    m_flash_bytes = 0;
+    m_copied_bytes = 0;
+}
+
+void FirmwareUpdate::handleUpload()
+{
+    HTTPUpload& upload(m_server.upload());
+
+    switch (upload.status) {
+    case UPLOAD_FILE_START:
+        reset();
+        Serial.printf("Update start: %s\n", upload.filename.c_str());
+        break;
+
+    case UPLOAD_FILE_WRITE:
+        m_payload_bytes += upload.currentSize;
+        if (m_failed) {
+            break;
+        }
+        if (m_kind == Kind::Unknown) {
+            m_failed = !beginUpload(upload.buf, upload.currentSize);
+        } else if (m_kind == Kind::Delta) {
+            m_failed = !writeDelta(upload.buf, upload.currentSize);
+        } else {
+            m_failed = !writeFlash(upload.buf, upload.currentSize);
+        }
+        if (m_failed) {
+            Update.end();
+        }
+        break;
+
+    case UPLOAD_FILE_END:
+        m_duration_ms = millis() - m_start_ms;
+        if (m_failed
+            || m_kind == Kind::Unknown) {
+            break;
+        }
+        if (m_kind == Kind::Delta
+            && !m_delta.finished()) {
+            m_error = "delta image truncated";
+            m_failed = true;
+            Update.end();
+            break;
+        }
+        // a plain or gzip image has no size up front, a delta must produce its target size exactly
+        if (!Update.end(m_kind != Kind::Delta)) {
+            m_error = Update.getErrorString();
+            m_failed = true;
+        }
+        break;
+
+    case UPLOAD_FILE_ABORTED:
+        m_duration_ms = millis() - m_start_ms;
+        m_error = "upload aborted";
+        m_failed = true;
+        Update.end();
+        break;
+    }
+}
+
+void FirmwareUpdate::handleResult()
+{
+    // without a file part handleUpload() never ran for this request
+    if (!m_failed
+        && (m_kind == Kind::Unknown || !Update.isFinished())) {
+        m_error = "no image";
+        m_failed = true;
+    }
+
+    uint32_t kbps(m_duration_ms ? (m_payload_bytes * 8) / m_duration_ms : 0);
+
+    char report[192];
+    snprintf(report, sizeof(report),
+        "kind: %s\npayload: %u bytes\nflash: %u bytes (%u copied from running firmware)\ntime: %u ms (%u kbit/s payload)\n",
+        kindName(m_kind), m_payload_bytes, m_flash_bytes, m_copied_bytes, m_duration_ms, kbps);
+    Serial.printf("%s", report);
+
+    m_server.sendHeader("Connection", "close");
+    if (m_failed) {
+        Serial.printf("Update failed: %s\n", m_error.c_str());
+        m_server.send(500, "text/plain", String("FAIL ") + m_error + "\n" + report);
+    } else {
+        Serial.printf("Update done, restarting\n");
+        m_server.send(200, "text/plain", String("OK\n") + report);
+        m_restart_at = millis() + 500;
+    }
+
+    reset();
+}
+
+bool FirmwareUpdate::beginUpload(const uint8_t* data, size_t size)
+{
+    m_kind = detect(data, size);
+    Serial.printf("Update kind: %s\n", kindName(m_kind));
+
+    switch (m_kind) {
+    case Kind::Image:
+    case Kind::Gzip: {
+        uint32_t max_sketch_space((ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000);
+        if (!Update.begin(max_sketch_space)) {
+            m_error = Update.getErrorString();
+            return false;
+        }
+        return writeFlash(data, size);
+    }
+    case Kind::Delta:
+        return writeDelta(data, size);
+    default:
+        m_error = "unknown image format";
+        return false;
+    }
+}
+
+bool FirmwareUpdate::writeDelta(const uint8_t* data, size_t size)
+{
+    if (m_delta.write(data, size)) {
+        return true;
+    }
+    if (m_delta.error()) {
+        m_error = m_delta.error();
+    }
+    return false;
+}
+
+bool FirmwareUpdate::beginDelta(const DeltaHeader& header)
+{
+    String source_md5(hex(header.source_md5));
+    String target_md5(hex(header.target_md5));
+
+    Serial.printf("Delta: source %u bytes md5 %s, target %u bytes md5 %s\n",
+        header.source_size, source_md5.c_str(), header.target_size, target_md5.c_str());
+
+    // checked before Update.begin(), so a delta for another base leaves the update area alone
+    if (header.source_size != ESP.getSketchSize()) {
+        m_error = String("delta base is ") + header.source_size + " bytes, running firmware " + ESP.getSketchSize();
+        return false;
+    }
+    String running(runningMD5());
+    if (running != source_md5) {
+        m_error = String("delta base md5 ") + source_md5 + " does not match running firmware " + running;
+        return false;
+    }
+
+    if (!Update.begin(header.target_size)) {
+        m_error = Update.getErrorString();
+        return false;
+    }
+    Update.setMD5(target_md5.c_str());
+    return true;
+}
+
+bool FirmwareUpdate::copy(uint32_t offset, uint32_t length)
+{
+    // no offset + length, a crafted delta could wrap it around;
+    // the image header is not covered by the source md5, so it is never copied
+    uint32_t size(ESP.getSketchSize());
+    if (offset < DeltaDecoder::HEADER_LITERAL
+        || length > size
+        || offset > size - length) {
+        m_error = "delta copies beyond running firmware";
+        return false;
+    }
+
+    alignas(4) uint8_t buffer[COPY_CHUNK_SIZE];
+    while (length > 0) {
+        uint32_t chunk(std::min<uint32_t>(length, COPY_CHUNK_SIZE));
+        if (!ESP.flashRead(offset, buffer, chunk)) {
+            m_error = "flash read failed";
+            return false;
+        }
+        if (!writeFlash(buffer, chunk)) {
+            return false;
+        }
+        m_copied_bytes += chunk;
+        offset += chunk;
+        length -= chunk;
+        yield();
+    }
+    return true;
+}
+
+bool FirmwareUpdate::insert(const uint8_t* data, size_t size)
+{
+    return writeFlash(data, size);
+}
+
+bool FirmwareUpdate::writeFlash(const uint8_t* data, size_t size)
+{
+    if (Update.write(const_cast<uint8_t*>(data), size) != size) {
+        m_error = Update.getErrorString();
+        return false;
+    }
+    m_flash_bytes += size;
+    return true;
+}
+
+String FirmwareUpdate::runningMD5()
+{
+    // skips the image header like tools/ota.py, the uploader may have patched it
+    MD5Builder md5;
+    md5.begin();
+
+    alignas(4) uint8_t buffer[COPY_CHUNK_SIZE];
+    uint32_t offset(DeltaDecoder::HEADER_LITERAL);
+    uint32_t end(ESP.getSketchSize());
+    while (offset < end) {
+        uint32_t chunk(std::min<uint32_t>(end - offset, COPY_CHUNK_SIZE));
+        if (!ESP.flashRead(offset, buffer, chunk)) {
+            return String();
+        }
+        md5.add(buffer, chunk);
+        offset += chunk;
+        yield();
+    }
+    md5.calculate();
+    return md5.toString();
+}
+
+FirmwareUpdate::Kind FirmwareUpdate::detect(const uint8_t* data, size_t size)
+{
+    if (DeltaDecoder::isDelta(data, size)) {
+        return Kind::Delta;
+    }
+    if (size >= 2 && data[0] == 0x1f && data[1] == 0x8b) {
+        return Kind::Gzip;
+    }
+    if (size >= 1 && data[0] == 0xe9) {
+        return Kind::Image;
+    }
+    return Kind::Unknown;
+}
+
+String FirmwareUpdate::hex(const uint8_t* md5)
+{
+    char text[33];
+    for (uint8_t index = 0; index < 16; ++index) {
+        sprintf(text + index * 2, "%02x", md5[index]);
+    }
+    return String(text);
+}
+
+const char* FirmwareUpdate::kindName(Kind kind)
+{
+    switch (kind) {
+    case Kind::Image:
+        return "image";
+    case Kind::Gzip:
+        return "gzip";
+    case Kind::Delta:
+        return "delta";
+    default:
+        return "unknown";
+    }
+}
+
+} // namespace lightsaber
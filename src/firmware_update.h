@@ -0,0 +1,70 @@
+#pragma once
+#include <Arduino.h>
+#include <ESP8266WebServer.h>
+
+#include "delta_decoder.h"
+
+namespace lightsaber {
+
+// HTTP firmware upload, active next to EasyOTA while in OTA boot mode.
+//
+// POST /update (multipart, field "firmware") accepts:
+//  - a plain image (.bin, magic 0xE9)
+//  - a gzip compressed image (.bin.gz, magic 0x1F 0x8B),
+//    decompressed by the boot loader while it copies the staged image
+//  - a delta image (.delta, magic "LSD1") against the running firmware,
+//    created with tools/ota.py
+//
+class FirmwareUpdate : private DeltaSink {
+public:
+    enum class Kind {
+        Unknown,
+        Image,
+        Gzip,
+        Delta
+    };
+
+    FirmwareUpdate();
+
+    void begin();
+    void loop();
+
+private:
+    static const uint16_t COPY_CHUNK_SIZE = 256;
+
+    void reset();
+    void handleUpload();
+    void handleResult();
+
+    bool beginUpload(const uint8_t* data, size_t size);
+    bool writeDelta(const uint8_t* data, size_t size);
+    bool writeFlash(const uint8_t* data, size_t size);
+    String runningMD5();
+
+    // DeltaSink
+    bool beginDelta(const DeltaHeader& header) override;
+    bool copy(uint32_t offset, uint32_t length) override;
+    bool insert(const uint8_t* data, size_t size) override;
+
+    static Kind detect(const uint8_t* data, size_t size);
+    static String hex(const uint8_t* md5);
+    static const char* kindName(Kind kind);
+
+    ESP8266WebServer m_server;
+    DeltaDecoder m_delta;
+
+    Kind m_kind{ Kind::Unknown };
+    bool m_failed{ false };
+    String m_error;
+
+    // metrics of the current / last transfer
+    uint32_t m_start_ms{ 0 };
+    uint32_t m_duration_ms{ 0 };
+    uint32_t m_payload_bytes{ 0 };
+    uint32_t m_flash_bytes{ 0 };
+    uint32_t m_copied_bytes{ 0 };
+
+    uint32_t m_restart_at{ 0 };
+};
+
+} // namespace lightsaber
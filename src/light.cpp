@@ -6,6 +6,9 @@ Light::Light()
     : m_strip(m_pixel_count)
     , m_animations(2)
 {
+    m_heap.strip = m_free_before_strip - m_free_before_animations;
+    m_heap.animations = m_free_before_animations - ESP.getFreeHeap();
+    m_heap.sequence = 0;
 }
 
 void Light::begin()
@@ -21,6 +24,9 @@ void Light::onAnimation(const AnimationParam& param)
     for (uint16_t index = 0; index < (m_pixel_count * progress); ++index) {
         m_strip.SetPixelColor(index, m_color);
     }
+    if (param.state == AnimationState_Completed) {
+        m_shimmer_active = true;
+    }
 }
 void Light::changeAnimation(const AnimationParam& param)
 {
@@ -30,6 +36,10 @@ void Light::changeAnimation(const AnimationParam& param)
     }
     float progress = NeoEase::QuinticOut(param.progress);
     m_strip.ClearTo(RgbColor::LinearBlend(m_color, m_color_blend, progress));
+    if (param.state == AnimationState_Completed) {
+        m_color = m_color_blend;
+        m_shimmer_active = true;
+    }
 }
 void Light::rainbowAnimation(const AnimationParam& param)
 {
@@ -95,6 +105,75 @@ void Light::batteryLowAnimation_2(const AnimationParam& param)
     m_strip.SetPixelColor(m_pixel_count * progress, RgbColor::LinearBlend(RgbColor(0x33, 0x0, 0x0), RgbColor(0x0, 0x0, 0x0), progress));
 }
 
+void Light::shimmerFrame()
+{
+    uint32_t start(ESP.getCycleCount());
+    m_shimmer.render(m_color.R, m_color.G, m_color.B, m_frame, m_pixel_count);
+    m_shimmer_cycles += ESP.getCycleCount() - start;
+
+    for (uint16_t index = 0; index < m_pixel_count; ++index) {
+        m_strip.SetPixelColor(index, RgbColor(m_frame[index * 3], m_frame[index * 3 + 1], m_frame[index * 3 + 2]));
+    }
+
+    if (++m_shimmer_frames == m_report_frames) {
+        uint32_t per_pixel(m_shimmer_cycles / (static_cast<uint32_t>(m_shimmer_frames) * m_pixel_count));
+        uint32_t per_frame_us(m_shimmer_cycles / m_shimmer_frames / ESP.getCpuFreqMHz());
+        Serial.printf("Shimmer: %u cycles/pixel (budget %u)%s, %u us/frame for %u pixels\n",
+            per_pixel, Shimmer::CYCLE_BUDGET, per_pixel > Shimmer::CYCLE_BUDGET ? " OVER BUDGET" : "",
+            per_frame_us, m_pixel_count);
+        m_shimmer_cycles = 0;
+        m_shimmer_frames = 0;
+    }
+}
+
+void Light::lockup()
+{
+    // a flash stored while not shimmering would go off at the next on/change
+    if (m_shimmer_active) {
+        m_shimmer.lockup();
+    }
+}
+
+bool Light::toggleUnstable()
+{
+    bool unstable(m_shimmer.effect() == Shimmer::Effect::Flicker);
+    m_shimmer.setEffect(unstable ? Shimmer::Effect::Unstable : Shimmer::Effect::Flicker);
+    return unstable;
+}
+
+bool Light::benchmark()
+{
+    // the largest supported blade into a scratch frame, the running blade is left alone
+    Shimmer shimmer;
+    uint8_t frame[m_benchmark_pixels * 3];
+    bool within_budget(true);
+
+    for (uint8_t pass = 0; pass < 3; ++pass) {
+        shimmer.seed(Shimmer::DEFAULT_SEED);
+        shimmer.setEffect(pass == 1 ? Shimmer::Effect::Unstable : Shimmer::Effect::Flicker);
+
+        uint32_t cycles(0);
+        for (uint16_t index = 0; index < m_benchmark_frames; ++index) {
+            if (pass == 2) {
+                shimmer.lockup();
+            }
+            uint32_t start(ESP.getCycleCount());
+            shimmer.render(0x0, 0x0, 0xff, frame, m_benchmark_pixels);
+            cycles += ESP.getCycleCount() - start;
+        }
+
+        uint32_t per_pixel(cycles / (static_cast<uint32_t>(m_benchmark_frames) * m_benchmark_pixels));
+        bool over(per_pixel > Shimmer::CYCLE_BUDGET);
+        Serial.printf("Shimmer benchmark %s: %u cycles/pixel (budget %u), %u us/frame for %u pixels%s\n",
+            pass == 0 ? "flicker" : (pass == 1 ? "unstable" : "lockup"),
+            per_pixel, Shimmer::CYCLE_BUDGET, cycles / m_benchmark_frames / ESP.getCpuFreqMHz(),
+            m_benchmark_pixels, over ? " OVER BUDGET" : "");
+        within_budget = within_budget && !over;
+        yield();
+    }
+    return within_budget;
+}
+
 RgbColor Light::colorForIndex(uint8_t index)
 {
     RgbColor ret(0x0, 0x0, 0x0);
@@ -144,10 +223,18 @@ RgbColor Light::rainbow(float progress)
     return ret;
 }
 
+void Light::setColorIndex(uint8_t index)
+{
+    m_color_index = index > 5 ? 0 : index;
+}
+
 uint8_t Light::beginSequence(Sequence sequence)
 {
+    uint32_t free_heap(ESP.getFreeHeap());
     m_animations.StopAnimation(0);
     m_animations.StopAnimation(1);
+    m_shimmer_active = false;
+    m_shimmer.endLockup();
     switch (sequence) {
     case Sequence::On:
         if (m_color_index < 4) {
@@ -183,12 +270,18 @@ uint8_t Light::beginSequence(Sequence sequence)
     default:
         break;
     }
+    m_heap.sequence = static_cast<int32_t>(free_heap - ESP.getFreeHeap());
     return m_color_index;
 }
 
 void Light::loop()
 {
     m_animations.UpdateAnimations();
+    if (m_shimmer_active
+        && millis() - m_last_frame >= m_frame_ms) {
+        m_last_frame = millis();
+        shimmerFrame();
+    }
     m_strip.Show();
 }
 
@@ -2,6 +2,8 @@
 #include <NeoPixelAnimator.h>
 #include <NeoPixelBus.h>
 
+#include "shimmer.h"
+
 namespace lightsaber {
 
 class Light {
@@ -14,6 +16,12 @@ public:
         Off
     };
 
+    struct HeapUsage {
+        uint32_t strip; // NeoPixelBus pixel and DMA buffers
+        uint32_t animations; // NeoPixelAnimator contexts
+        int32_t sequence; // std::function callbacks, change by the last beginSequence()
+    };
+
     Light();
 
     void begin();
@@ -21,6 +29,15 @@ public:
     uint8_t beginSequence(Sequence sequence);
     void loop();
 
+    uint8_t colorIndex() const { return m_color_index; }
+    void setColorIndex(uint8_t index);
+
+    void lockup();
+    bool toggleUnstable();
+    bool benchmark();
+
+    const HeapUsage& heapUsage() const { return m_heap; }
+
 private:
     void onAnimation(const AnimationParam& param);
     void changeAnimation(const AnimationParam& param);
@@ -30,6 +47,7 @@ private:
     void otaAnimation(const AnimationParam& param);
     void batteryLowAnimation_1(const AnimationParam& param);
     void batteryLowAnimation_2(const AnimationParam& param);
+    void shimmerFrame();
 
     static RgbColor colorForIndex(uint8_t index);
     static RgbColor rainbow(float progress);
@@ -41,9 +59,24 @@ private:
 
     const static uint16_t m_pixel_count = 24;
     const static uint8_t m_darken_by = 80;
+    const static uint8_t m_frame_ms = 10;
+    const static uint16_t m_report_frames = 1000;
+    const static uint16_t m_benchmark_pixels = 150;
+    const static uint16_t m_benchmark_frames = 100;
 
+    // free heap around the construction of m_strip and m_animations
+    uint32_t m_free_before_strip{ ESP.getFreeHeap() };
     NeoPixelBus<NeoGrbFeature, Neo800KbpsMethod> m_strip;
+    uint32_t m_free_before_animations{ ESP.getFreeHeap() };
     NeoPixelAnimator m_animations;
+    HeapUsage m_heap;
+
+    Shimmer m_shimmer;
+    bool m_shimmer_active{ false };
+    uint32_t m_last_frame{ 0 };
+    uint8_t m_frame[m_pixel_count * 3];
+    uint32_t m_shimmer_cycles{ 0 };
+    uint16_t m_shimmer_frames{ 0 };
 };
 
 } // namespace lightsaber
@@ -2,12 +2,18 @@
 #include <JeVe_EasyOTA.h>
 #include <ESP8266WiFi.h>
 
+#include "firmware_update.h"
 #include "light.h"
+#include "memory.h"
 #include "sound.h"
 #include "secrets.h"
+#include "settings.h"
 #include <push_button.h>
 
+using lightsaber::FirmwareUpdate;
 using lightsaber::Light;
+using lightsaber::Memory;
+using lightsaber::Settings;
 using lightsaber::Sound;
 using pb::PushButton;
 
@@ -18,19 +24,39 @@ PushButton button4(D3);
 
 Light light;
 Sound sound;
+Settings settings;
 Ticker tick;
 
 EasyOTA OTA(hostname);
+FirmwareUpdate firmwareUpdate;
+Memory memory;
 
 uint32_t lastADC;
 bool otaRequested(false);
 
+Settings::Values currentSettings()
+{
+    return { sound.volume(), light.colorIndex(), sound.advertIndex(), sound.storyIndex() };
+}
+
 void setup()
 {
     Serial.begin(115200);
     Serial.printf("Go! \n");
 
+    memory.begin();
+    memory.object("Light", sizeof(light));
+    memory.heap("NeoPixelBus", light.heapUsage().strip);
+    memory.heap("NeoPixelAnimator", light.heapUsage().animations);
+    memory.object("Sound", sizeof(sound));
+    memory.object("Settings", sizeof(settings));
+    memory.object("EasyOTA", sizeof(OTA));
+    memory.object("FirmwareUpdate", sizeof(firmwareUpdate));
+    memory.object("PushButton x4", 4 * sizeof(PushButton));
+
     light.begin();
+    memory.checkpoint("Light::begin");
+    light.benchmark();
 
     if (digitalRead(D5) == 0)
     {
@@ -40,6 +66,8 @@ void setup()
             Serial.println(message);
         });
         OTA.addAP(ssid, password);
+        firmwareUpdate.begin();
+        memory.checkpoint("OTA");
         Serial.printf("OTA active!\n");
 
         light.beginSequence(Light::Sequence::OTA);
@@ -47,6 +75,13 @@ void setup()
         WiFi.disconnect();
         WiFi.mode(WIFI_OFF);
         WiFi.forceSleepBegin();
+
+        if (settings.begin(currentSettings())) {
+            const Settings::Values& values(settings.values());
+            light.setColorIndex(values.color_index);
+            sound.restore(values.volume, values.advert_index, values.story_index);
+        }
+        memory.checkpoint("Settings::begin");
     }
 
     pinMode(D8, OUTPUT);
@@ -58,7 +93,7 @@ void setup()
 #if 0
 button | short            | long               | double               | triple
 -----------------------------------------------------------------------------------------------
- -1-   | change color     |                    |                      | battery low simulation
+ -1-   | change color     | lockup flash       | flicker/unstable     | battery low simulation
        | press on startup:|                    |                      |
        |   start in OTA   |                    |                      |
        |   mode           |                    |                      |
@@ -82,16 +117,25 @@ void loop()
 {
     if (otaRequested) {
         OTA.loop();
+        firmwareUpdate.loop();
         light.loop();
+
+        if (millis() - lastADC > 5000) {
+            memory.sample();
+            memory.report();
+            lastADC = millis();
+        }
         return;
     }
 
     if (!initialized
         && millis() > 1000) {
         light.beginSequence(Light::Sequence::On);
+        memory.heap("Light callbacks", light.heapUsage().sequence);
 
         sound.begin();
         sound.playOn();
+        memory.checkpoint("Sound::begin");
 
         initialized = true;
     }
@@ -113,6 +157,15 @@ void loop()
                 uint8_t index(light.beginSequence(Light::Sequence::Change));
                 sound.playChange(index);
             }
+        } else if (e1 == PushButton::Event::LONG_PRESS) {
+            Serial.printf("button 1 - PushButton::Event::LONG_PRESS\n");
+            if (on) {
+                Serial.printf("Lockup\n");
+                light.lockup();
+            }
+        } else if (e1 == PushButton::Event::DOUBLE_PRESS) {
+            Serial.printf("button 1 - PushButton::Event::DOUBLE_PRESS\n");
+            Serial.printf("Blade %s\n", light.toggleUnstable() ? "Unstable" : "Flicker");
         } else if (e1 == PushButton::Event::TRIPLE_PRESS) {
             Serial.printf("button 1 - PushButton::Event::TRIPLE_PRESS\n");
             if (on) {
@@ -141,6 +194,8 @@ void loop()
                 Serial.printf("Retract + Switch Off\n");
                 sound.playOff(story);
                 light.beginSequence(Light::Sequence::Off);
+                settings.update(currentSettings());
+                settings.commit();
                 tick.once_ms(2000, []() {
                     digitalWrite(D8, HIGH);
                 });
@@ -167,7 +222,7 @@ void loop()
             } else {
                 Serial.printf("Story Mode\n");
                 story = true;
-                sound.story(false);
+                sound.resumeStory();
             }
         } else if (e3 == PushButton::Event::DOUBLE_PRESS) {
             Serial.printf("button 3 - PushButton::Event::DOUBLE_PRESS\n");
@@ -195,10 +250,15 @@ void loop()
             sound.volumeDown();
         }
 
+        settings.update(currentSettings());
+        settings.loop();
+
         if (millis() - lastADC > 5000) {
             int vBat(analogRead(A0));
 
             Serial.printf("Battery Voltage: %iV\n", vBat);
+            memory.sample();
+            memory.report();
             lastADC = millis();
 
             if (!lowBatterySignaled
@@ -206,6 +266,8 @@ void loop()
                 lowBatterySignaled = true;
                 sound.playBatteryLow();
                 light.beginSequence(Light::Sequence::BatteryLow);
+                settings.update(currentSettings());
+                settings.commit();
 
                 tick.once_ms(15000, []() {
                     digitalWrite(D8, HIGH);
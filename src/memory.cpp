@@ -0,0 +1,60 @@
+#include "memory.h"
+
+extern "C" char _heap_start;
+
+namespace lightsaber {
+
+Memory::Memory()
+{
+}
+
+void Memory::begin()
+{
+    m_last_free = ESP.getFreeHeap();
+    Serial.printf("Memory: heap %u bytes, %u used by global constructors, %u free\n",
+        heapSize(), heapSize() - m_last_free, m_last_free);
+}
+
+void Memory::object(const char* name, size_t size)
+{
+    Serial.printf("Memory: %-16s %5u bytes static\n", name, size);
+}
+
+void Memory::heap(const char* name, int32_t size)
+{
+    Serial.printf("Memory: %-16s %5d bytes heap\n", name, size);
+}
+
+void Memory::checkpoint(const char* what)
+{
+    uint32_t free_heap(ESP.getFreeHeap());
+    Serial.printf("Memory: %-16s %5d bytes heap (%u free)\n",
+        what, static_cast<int32_t>(m_last_free - free_heap), free_heap);
+    m_last_free = free_heap;
+}
+
+void Memory::sample()
+{
+    m_free = ESP.getFreeHeap();
+    m_max_block = ESP.getMaxFreeBlockSize();
+    m_fragmentation = ESP.getHeapFragmentation();
+
+    m_min_free = std::min(m_min_free, m_free);
+    m_min_max_block = std::min(m_min_max_block, m_max_block);
+    m_max_fragmentation = std::max(m_max_fragmentation, m_fragmentation);
+    ++m_samples;
+}
+
+void Memory::report() const
+{
+    Serial.printf("Memory: free %u (min %u), max block %u (min %u), fragmentation %u%% (max %u%%), %u samples\n",
+        m_free, m_min_free, m_max_block, m_min_max_block, m_fragmentation, m_max_fragmentation, m_samples);
+}
+
+uint32_t Memory::heapSize()
+{
+    // umm_malloc owns everything from the end of .bss up to the SDK's area
+    return 0x3fffc000 - reinterpret_cast<uint32_t>(&_heap_start);
+}
+
+} // namespace lightsaber
@@ -0,0 +1,38 @@
+#pragma once
+#include <Arduino.h>
+
+namespace lightsaber {
+
+// Heap accounting on the target.
+// Static RAM/flash per module and the budget check come from the build,
+// see tools/memory_budget.py.
+// Allocations per call path on the host: alloc_tracker.h.
+//
+class Memory {
+public:
+    Memory();
+
+    void begin();
+    void object(const char* name, size_t size);
+    void heap(const char* name, int32_t size);
+    void checkpoint(const char* what);
+
+    void sample();
+    void report() const;
+
+private:
+    static uint32_t heapSize();
+
+    uint32_t m_last_free{ 0 };
+
+    uint32_t m_free{ 0 };
+    uint32_t m_max_block{ 0 };
+    uint8_t m_fragmentation{ 0 };
+
+    uint32_t m_min_free{ UINT32_MAX };
+    uint32_t m_min_max_block{ UINT32_MAX };
+    uint8_t m_max_fragmentation{ 0 };
+    uint32_t m_samples{ 0 };
+};
+
+} // namespace lightsaber
@@ -0,0 +1,191 @@
+#include "settings.h"
+
+namespace lightsaber {
+
+bool Settings::Values::operator==(const Values& other) const
+{
+    return volume == other.volume
+        && color_index == other.color_index
+        && advert_index == other.advert_index
+        && story_index == other.story_index;
+}
+
+Settings::Settings()
+{
+}
+
+bool Settings::begin(const Values& defaults)
+{
+    uint32_t start(micros());
+    m_values = defaults;
+
+    m_available = FS_PHYS_SIZE >= SECTOR_COUNT * FLASH_SECTOR_SIZE;
+    if (!m_available) {
+        Serial.printf("Settings: no flash area, not persisted\n");
+        return false;
+    }
+
+    bool found(false);
+    for (uint8_t sector = 0; sector < SECTOR_COUNT; ++sector) {
+        uint32_t header[HEADER_SIZE / 4];
+        ESP.flashRead(sectorAddress(sector), header, HEADER_SIZE);
+        if (header[0] == SECTOR_MAGIC
+            && (!found || header[1] > m_generation)) {
+            m_sector = sector;
+            m_generation = header[1];
+            found = true;
+        }
+    }
+
+    bool loaded(false);
+    if (found) {
+        m_free_slot = findFreeSlot(m_sector);
+        // walk back over a record torn by a power loss
+        for (uint16_t slot = m_free_slot; slot > 0 && !loaded; --slot) {
+            Record record;
+            if (readRecord(m_sector, slot - 1, record)) {
+                m_values.volume = record.fields.volume;
+                m_values.color_index = record.fields.color_index;
+                m_values.advert_index = record.fields.advert_index;
+                m_values.story_index = record.fields.story_index;
+                loaded = true;
+            }
+        }
+    } else {
+        // nothing written yet, the first commit starts sector 0
+        m_sector = SECTOR_COUNT - 1;
+        m_generation = 0;
+        m_free_slot = RECORDS_PER_SECTOR;
+    }
+
+    Serial.printf("Settings: %s in %u us (sector %u, generation %u, slot %u)\n",
+        loaded ? "loaded" : "defaults", micros() - start, m_sector, m_generation, m_free_slot);
+    return loaded;
+}
+
+void Settings::loop()
+{
+    if (m_dirty
+        && millis() - m_changed_at >= QUIET_PERIOD_MS) {
+        commit();
+    }
+}
+
+void Settings::update(const Values& values)
+{
+    if (values != m_values) {
+        m_values = values;
+        m_dirty = true;
+        m_changed_at = millis();
+    }
+}
+
+void Settings::commit()
+{
+    if (!m_dirty
+        || !m_available) {
+        return;
+    }
+
+    Record record;
+    record.fields.volume = m_values.volume;
+    record.fields.color_index = m_values.color_index;
+    record.fields.advert_index = m_values.advert_index;
+    record.fields.story_index = m_values.story_index;
+    record.fields.reserved = 0;
+    record.fields.crc = crc8(reinterpret_cast<const uint8_t*>(&record), RECORD_SIZE - 1);
+
+    bool ok(false);
+    if (m_free_slot < RECORDS_PER_SECTOR) {
+        ok = ESP.flashWrite(recordAddress(m_sector, m_free_slot), record.words, RECORD_SIZE);
+        ++m_free_slot;
+    } else {
+        ok = startSector((m_sector + 1) % SECTOR_COUNT, m_generation + 1, record);
+    }
+    ++m_write_count;
+    m_dirty = false;
+
+    Serial.printf("Settings: %s (session writes: %u, erases: %u)\n",
+        ok ? "committed" : "commit failed", m_write_count, m_erase_count);
+}
+
+uint32_t Settings::sectorAddress(uint8_t sector) const
+{
+    return FS_PHYS_ADDR + static_cast<uint32_t>(sector) * FLASH_SECTOR_SIZE;
+}
+
+uint32_t Settings::recordAddress(uint8_t sector, uint16_t slot) const
+{
+    return sectorAddress(sector) + HEADER_SIZE + static_cast<uint32_t>(slot) * RECORD_SIZE;
+}
+
+bool Settings::readRecord(uint8_t sector, uint16_t slot, Record& record) const
+{
+    if (!ESP.flashRead(recordAddress(sector, slot), record.words, RECORD_SIZE)) {
+        return false;
+    }
+    return !isErased(record)
+        && record.fields.crc == crc8(reinterpret_cast<const uint8_t*>(&record), RECORD_SIZE - 1);
+}
+
+uint16_t Settings::findFreeSlot(uint8_t sector) const
+{
+    // records are appended in order, so the used slots are a prefix of the sector
+    uint16_t low(0);
+    uint16_t high(RECORDS_PER_SECTOR);
+    while (low < high) {
+        uint16_t middle((low + high) / 2);
+        Record record;
+        ESP.flashRead(recordAddress(sector, middle), record.words, RECORD_SIZE);
+        if (isErased(record)) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+    return low;
+}
+
+bool Settings::startSector(uint8_t sector, uint32_t generation, const Record& record)
+{
+    if (!ESP.flashEraseSector(sectorAddress(sector) / FLASH_SECTOR_SIZE)) {
+        return false;
+    }
+    ++m_erase_count;
+
+    // the header goes last: a sector torn before it stays invalid and the old one is used
+    uint32_t header[HEADER_SIZE / 4] = { SECTOR_MAGIC, generation };
+    if (!ESP.flashWrite(recordAddress(sector, 0), record.words, RECORD_SIZE)
+        || !ESP.flashWrite(sectorAddress(sector), header, HEADER_SIZE)) {
+        return false;
+    }
+
+    m_sector = sector;
+    m_generation = generation;
+    m_free_slot = 1;
+    return true;
+}
+
+bool Settings::isErased(const Record& record)
+{
+    for (uint8_t index = 0; index < RECORD_SIZE / 4; ++index) {
+        if (record.words[index] != 0xffffffff) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint8_t Settings::crc8(const uint8_t* data, size_t size)
+{
+    uint8_t crc(0);
+    while (size--) {
+        crc ^= *data++;
+        for (uint8_t bit = 0; bit < 8; ++bit) {
+            crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+} // namespace lightsaber
@@ -0,0 +1,76 @@
+#pragma once
+#include <Arduino.h>
+#include <flash_hal.h>
+
+namespace lightsaber {
+
+// Persistent user settings, kept as an append-only log of small records
+// in a few flash sectors at the start of the (unused) file system area.
+// Changes are held in RAM and committed after a quiet period, or on commit().
+// When a sector is full the log moves on to the next one, so erases are
+// spread over all sectors.
+//
+class Settings {
+public:
+    struct Values {
+        int8_t volume;
+        uint8_t color_index;
+        int16_t advert_index;
+        int16_t story_index;
+
+        bool operator==(const Values& other) const;
+        bool operator!=(const Values& other) const { return !(*this == other); }
+    };
+
+    Settings();
+
+    bool begin(const Values& defaults);
+    void loop();
+
+    const Values& values() const { return m_values; }
+    void update(const Values& values);
+    void commit();
+
+private:
+    static const uint32_t SECTOR_MAGIC = 0x4c534331; // "LSC1"
+    static const uint8_t SECTOR_COUNT = 4;
+    static const uint16_t HEADER_SIZE = 8;
+    static const uint16_t RECORD_SIZE = 8;
+    static const uint16_t RECORDS_PER_SECTOR = (FLASH_SECTOR_SIZE - HEADER_SIZE) / RECORD_SIZE;
+    static const uint32_t QUIET_PERIOD_MS = 10000;
+
+    union Record {
+        struct {
+            int8_t volume;
+            uint8_t color_index;
+            int16_t advert_index;
+            int16_t story_index;
+            uint8_t reserved;
+            uint8_t crc;
+        } fields;
+        uint32_t words[RECORD_SIZE / 4];
+    };
+
+    uint32_t sectorAddress(uint8_t sector) const;
+    uint32_t recordAddress(uint8_t sector, uint16_t slot) const;
+    bool readRecord(uint8_t sector, uint16_t slot, Record& record) const;
+    uint16_t findFreeSlot(uint8_t sector) const;
+    bool startSector(uint8_t sector, uint32_t generation, const Record& record);
+
+    static bool isErased(const Record& record);
+    static uint8_t crc8(const uint8_t* data, size_t size);
+
+    bool m_available{ false };
+    uint8_t m_sector{ 0 };
+    uint32_t m_generation{ 0 };
+    uint16_t m_free_slot{ 0 };
+
+    Values m_values{ 0, 0, 0, 0 };
+    bool m_dirty{ false };
+    uint32_t m_changed_at{ 0 };
+
+    uint16_t m_write_count{ 0 };
+    uint16_t m_erase_count{ 0 };
+};
+
+} // namespace lightsaber
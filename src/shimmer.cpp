@@ -0,0 +1,112 @@
+#include "shimmer.h"
+
+namespace lightsaber {
+
+Shimmer::Shimmer(uint32_t seed)
+{
+    // smoothstep 3t^2 - 2t^3, t in 0..255
+    for (uint16_t t = 0; t < 256; ++t) {
+        m_smooth[t] = static_cast<uint8_t>((t * t * (768 - 2 * t)) >> 16);
+    }
+    this->seed(seed);
+}
+
+void Shimmer::seed(uint32_t seed)
+{
+    uint32_t state(seed ? seed : 1);
+    for (uint16_t index = 0; index < 256; ++index) {
+        m_perm[index] = static_cast<uint8_t>(index);
+    }
+    for (uint16_t index = 255; index > 0; --index) {
+        // xorshift32
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        uint8_t other(state % (index + 1));
+        uint8_t swap(m_perm[index]);
+        m_perm[index] = m_perm[other];
+        m_perm[other] = swap;
+    }
+    m_time = 0;
+    m_lockup = 0;
+}
+
+void Shimmer::setEffect(Effect effect)
+{
+    m_effect = effect;
+}
+
+void Shimmer::lockup()
+{
+    m_lockup = 255;
+}
+
+void Shimmer::endLockup()
+{
+    m_lockup = 0;
+}
+
+void Shimmer::render(uint8_t red, uint8_t green, uint8_t blue, uint8_t* rgb, uint16_t pixel_count)
+{
+    bool unstable(m_effect == Effect::Unstable);
+
+    for (uint16_t index = 0; index < pixel_count; ++index) {
+        uint16_t x(index * PIXEL_STEP);
+        uint8_t value(noise(x, m_time));
+        uint8_t level;
+        uint8_t white(0);
+
+        if (unstable) {
+            level = 128 + (value >> 1);
+            // finer and faster noise, only its peaks crackle
+            uint8_t spark(noise(x * 3 + 0x8000, m_time * 3));
+            if (spark > CRACKLE_THRESHOLD) {
+                white = (spark - CRACKLE_THRESHOLD) * 8;
+            }
+        } else {
+            level = 192 + (value >> 2);
+        }
+
+        if (m_lockup) {
+            uint8_t flash((m_lockup * value) >> 8);
+            level = 255;
+            if (flash > white) {
+                white = flash;
+            }
+        }
+
+        *rgb++ = scale(red, level, white);
+        *rgb++ = scale(green, level, white);
+        *rgb++ = scale(blue, level, white);
+    }
+
+    m_time += unstable ? UNSTABLE_SPEED : FLICKER_SPEED;
+    m_lockup = m_lockup > LOCKUP_DECAY ? m_lockup - LOCKUP_DECAY : 0;
+}
+
+uint8_t Shimmer::noise(uint16_t x, uint16_t t) const
+{
+    uint8_t xi(x >> 8);
+    uint8_t ti(t >> 8);
+    int16_t sx(m_smooth[x & 0xff]);
+    int16_t st(m_smooth[t & 0xff]);
+
+    uint8_t h0(m_perm[xi]);
+    uint8_t h1(m_perm[static_cast<uint8_t>(xi + 1)]);
+    int16_t a(m_perm[static_cast<uint8_t>(h0 + ti)]);
+    int16_t b(m_perm[static_cast<uint8_t>(h1 + ti)]);
+    int16_t c(m_perm[static_cast<uint8_t>(h0 + ti + 1)]);
+    int16_t d(m_perm[static_cast<uint8_t>(h1 + ti + 1)]);
+
+    int16_t ab(a + (((b - a) * sx) >> 8));
+    int16_t cd(c + (((d - c) * sx) >> 8));
+    return static_cast<uint8_t>(ab + (((cd - ab) * st) >> 8));
+}
+
+uint8_t Shimmer::scale(uint8_t value, uint8_t level, uint8_t white)
+{
+    uint16_t ret(((value * (level + 1)) >> 8) + white);
+    return ret > 255 ? 255 : ret;
+}
+
+} // namespace lightsaber
@@ -0,0 +1,56 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+namespace lightsaber {
+
+// Procedural blade shimmer: 2D value noise over (pixel, time) in 8.8 fixed
+// point, permutation and smoothstep tables in RAM, no floats.
+// Only depends on the C library, so it builds on the host as well; the same
+// seed always gives the same frames.
+//
+// Frame budget at 100 fps is 10 ms. Show() of 150 pixels at 800 kbps takes
+// ~4.5 ms, which leaves CYCLE_BUDGET cycles per pixel at 80 MHz for render();
+// Light::benchmark() checks it for 150 pixels, Light reports the running blade.
+//
+class Shimmer {
+public:
+    enum class Effect {
+        Flicker,
+        Unstable
+    };
+
+    static const uint32_t DEFAULT_SEED = 0x5ab3e5;
+    static const uint16_t CYCLE_BUDGET = 2600;
+
+    explicit Shimmer(uint32_t seed = DEFAULT_SEED);
+
+    void seed(uint32_t seed);
+    void setEffect(Effect effect);
+    Effect effect() const { return m_effect; }
+    void lockup();
+    void endLockup();
+
+    // next frame: pixel_count RGB triples of base color, modulated
+    void render(uint8_t red, uint8_t green, uint8_t blue, uint8_t* rgb, uint16_t pixel_count);
+
+    uint8_t noise(uint16_t x, uint16_t t) const;
+
+private:
+    static const uint8_t FLICKER_SPEED = 24;
+    static const uint8_t UNSTABLE_SPEED = 72;
+    static const uint8_t PIXEL_STEP = 40;
+    static const uint8_t CRACKLE_THRESHOLD = 224;
+    static const uint8_t LOCKUP_DECAY = 8;
+
+    static uint8_t scale(uint8_t value, uint8_t level, uint8_t white);
+
+    uint8_t m_perm[256];
+    uint8_t m_smooth[256];
+
+    Effect m_effect{ Effect::Flicker };
+    uint16_t m_time{ 0 };
+    uint8_t m_lockup{ 0 };
+};
+
+} // namespace lightsaber
@@ -13,17 +13,40 @@ void Sound::begin()
     mp3.begin();
     mp3.setVolume(m_volume);
 
+    uint32_t start(micros());
     m_total_track_count = mp3.getTotalTrackCount();
     m_total_folder_count = mp3.getTotalFolderCount();
     m_folder_1_track_count = mp3.getFolderTrackCount(1);
     m_folder_2_track_count = mp3.getFolderTrackCount(2);
     m_advert_track_count = m_total_track_count - m_folder_1_track_count - m_folder_2_track_count;
+    // compare with the Settings load time at boot
+    Serial.printf("Sound: DFPlayer queries in %u us\n", micros() - start);
 
     Serial.printf("getTotalTrackCount: %u\n", m_total_track_count);
     Serial.printf("getTotalFolderCount: %u\n", m_total_folder_count);
     Serial.printf("getFolderTrackCount(1): %u\n", m_folder_1_track_count);
     Serial.printf("getFolderTrackCount(2): %u\n", m_folder_2_track_count);
     Serial.printf("Advert Track Count: %u\n", m_advert_track_count);
+
+    // restored indexes may point past the tracks of another SD card
+    if (m_advert_index > m_advert_track_count) {
+        m_advert_index = NUMBER_SYSTEM_SOUNDS;
+    }
+    if (m_story_index > m_folder_2_track_count) {
+        m_story_index = 0;
+    }
+}
+
+void Sound::restore(int8_t volume, int16_t advertIndex, int16_t storyIndex)
+{
+    m_volume = volume;
+    if (m_volume > MAX_VOLUME) {
+        m_volume = MAX_VOLUME;
+    } else if (m_volume < 0) {
+        m_volume = 0;
+    }
+    m_advert_index = advertIndex < NUMBER_SYSTEM_SOUNDS ? NUMBER_SYSTEM_SOUNDS : advertIndex;
+    m_story_index = storyIndex < 0 ? 0 : storyIndex;
 }
 
 void Sound::loop()
@@ -56,7 +79,6 @@ void Sound::volumeDown()
 void Sound::playEndlessHum()
 {
     mp3.stop();
-    m_story_index = 0;
     mp3.playFolderTrack16(1, 1);
 }
 void Sound::silence()
@@ -141,6 +163,17 @@ void Sound::story(bool previous)
     mp3.playFolderTrack16(2, m_story_index); // sd:/02/0001*.mp3
 }
 
+void Sound::resumeStory()
+{
+    if (m_story_index > 0) {
+        mp3.stop();
+        Serial.printf("Story Index: %i\n", m_story_index);
+        mp3.playFolderTrack16(2, m_story_index);
+    } else {
+        story(false);
+    }
+}
+
 /////////////////////////////////////////////
 /////////////////////////////////////////////
 
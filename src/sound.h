@@ -49,6 +49,12 @@ public:
     void playOff(bool story);
     void playBatteryLow();
     void story(bool previous);
+    void resumeStory();
+
+    int8_t volume() const { return m_volume; }
+    int16_t advertIndex() const { return m_advert_index; }
+    int16_t storyIndex() const { return m_story_index; }
+    void restore(int8_t volume, int16_t advertIndex, int16_t storyIndex);
 
 private:
     SoftwareSerial mp3Serial;
@@ -0,0 +1,204 @@
+#pragma once
+// generated by tools/delta_fixture.py, do not edit
+#include <stdint.h>
+
+static const uint8_t fixture_base[] = {
+    0xe9, 0x67, 0x69, 0xdd, 0x1d, 0x41, 0xf4, 0x15, 0x57, 0xdb, 0x7c, 0xd1, 0x67, 0x0e, 0x71, 0x49,
+    0x42, 0x6e, 0xf7, 0xc7, 0xba, 0x7c, 0x0f, 0x0f, 0x96, 0x3f, 0x16, 0x03, 0xed, 0xa0, 0xa3, 0xd8,
+    0xdd, 0x66, 0x1c, 0x80, 0x65, 0xc4, 0xdb, 0x4f, 0x1e, 0x32, 0x26, 0x40, 0x16, 0x18, 0xd0, 0x6f,
+    0xbd, 0x2e, 0xa7, 0x35, 0xd0, 0x17, 0xd7, 0xea, 0x26, 0x14, 0xb4, 0x31, 0x7a, 0x29, 0x44, 0x8d,
+    0xb2, 0xdf, 0xb1, 0xf0, 0xc7, 0x10, 0x16, 0x4d, 0x04, 0x39, 0xf3, 0x11, 0x5d, 0x11, 0x09, 0xdb,
+    0x18, 0x95, 0xdb, 0x53, 0x20, 0x95, 0x56, 0x32, 0x22, 0x10, 0x0a, 0xd8, 0x0b, 0x8d, 0xfb, 0xa4,
+    0xca, 0x0e, 0x33, 0x38, 0x69, 0xe1, 0x79, 0x9c, 0x77, 0x4a, 0xc5, 0xcd, 0xa1, 0x29, 0x21, 0x4f,
+    0x16, 0x0c, 0x49, 0xcb, 0x7c, 0xa5, 0x22, 0x66, 0x8f, 0xa5, 0xde, 0xf0, 0x6f, 0xff, 0x7a, 0x03,
+    0x33, 0x35, 0x0b, 0x6d, 0x6c, 0x32, 0x49, 0x44, 0x13, 0x54, 0x54, 0x1c, 0x1b, 0xc6, 0xf8, 0x3b,
+    0xd5, 0x69, 0xaf, 0x55, 0x76, 0x1e, 0x07, 0x9b, 0x85, 0xd5, 0x63, 0xe0, 0xfc, 0xa6, 0x83, 0x8c,
+    0x95, 0xf2, 0x19, 0x86, 0xcf, 0x1d, 0x1b, 0x9d, 0x5f, 0x97, 0x76, 0x70, 0x80, 0xd6, 0x0e, 0xa3,
+    0x6b, 0xef, 0x97, 0x30, 0x06, 0x32, 0x00, 0x1e, 0x24, 0x44, 0xc2, 0x2a, 0xb5, 0x3c, 0xf7, 0xca,
+    0xfd, 0x61, 0xd5, 0x80, 0x85, 0x33, 0xfb, 0x23, 0xbc, 0xef, 0x71, 0x88, 0x48, 0x37, 0x9a, 0x70,
+    0xb3, 0x45, 0xfe, 0x18, 0xef, 0x37, 0xe4, 0xf7, 0x98, 0x72, 0xe3, 0xe2, 0xf6, 0x69, 0x53, 0x28,
+    0x8d, 0x27, 0x77, 0x63, 0x10, 0x36, 0x8a, 0x7d, 0xeb, 0x3c, 0x5a, 0xb4, 0xd3, 0xe1, 0xd8, 0x64,
+    0x8d, 0x6e, 0x33, 0x43, 0xcb, 0x98, 0xf9, 0x22, 0xe6, 0x10, 0x9a, 0x4a, 0xbb, 0xfe, 0xb8, 0xb5,
+    0x08, 0xad, 0xd4, 0x0d, 0x05, 0xb9, 0x51, 0xb2, 0xbb, 0x7b, 0x47, 0x1e, 0xb5, 0xd2, 0x28, 0x49,
+    0x07, 0x77, 0xf0, 0xfc, 0x51, 0x49, 0x35, 0xc0, 0xc9, 0x83, 0x1b, 0x9e, 0xd4, 0x96, 0xfc, 0xcb,
+    0x68, 0x1c, 0xe7, 0x8c, 0x52, 0x7d, 0x4c, 0x4d, 0xbd, 0x0c, 0xb5, 0xfd, 0x35, 0x52, 0xb8, 0xb5,
+    0xaa, 0xc7, 0xf8, 0x8d, 0x93, 0xd8, 0xa1, 0xd4, 0xff, 0x92, 0x9e, 0x8c, 0xc7, 0x8f, 0xf1, 0xf9,
+    0xb6, 0x93, 0x1e, 0xb7, 0xcc, 0x87, 0x5d, 0x78, 0x6c, 0xf4, 0x67, 0x21, 0x2b, 0xbb, 0x4f, 0x63,
+    0xf6, 0xae, 0x1e, 0xfc, 0x82, 0x79, 0x9b, 0xda, 0x54, 0x12, 0xc2, 0x67, 0x14, 0x1d, 0xaf, 0xae,
+    0x60, 0xbb, 0xc7, 0xd0, 0x95, 0x18, 0x29, 0x29, 0xa7, 0xb4, 0x27, 0xed, 0x01, 0x88, 0x0f, 0x86,
+    0x3c, 0x83, 0xef, 0xb8, 0x9b, 0xe3, 0x9a, 0xe3, 0xab, 0x9a, 0x87, 0x50, 0x9c, 0x8b, 0xff, 0x04,
+    0xb2, 0x37, 0x21, 0xbc, 0x1f, 0x2e, 0x17, 0xc2, 0x78, 0xff, 0x1e, 0xd5, 0x26, 0xd0, 0x71, 0x77,
+    0xfb, 0x96, 0xf2, 0x34, 0x92, 0x57, 0x2e, 0x0b, 0x34, 0x0c, 0x96, 0x4b, 0x4e, 0xac, 0x98, 0x08,
+    0x6c, 0x5a, 0x1a, 0x98, 0xe0, 0x72, 0x66, 0x65, 0x92, 0x5d, 0x24, 0x3e, 0x39, 0xd6, 0x00, 0x1f,
+    0xdb, 0xb1, 0x5e, 0x85, 0x95, 0x06, 0xc8, 0x90, 0x4a, 0xdb, 0xb7, 0x05, 0xb5, 0x1c, 0xa4, 0xf0,
+    0xdd, 0xe6, 0x9c, 0x42, 0x6d, 0x39, 0x86, 0xf4, 0xb9, 0x7b, 0x04, 0x41, 0x41, 0x19, 0x20, 0xba,
+    0xdd, 0x43, 0x43, 0x49, 0x89, 0x9f, 0x2c, 0x48, 0xad, 0xce, 0x62, 0xa9, 0x67, 0x5a, 0xaf, 0x47,
+    0xc7, 0xf3, 0xbb, 0x22, 0xcc, 0x8c, 0x26, 0x1e, 0x06, 0xc3, 0x91, 0x62, 0x16, 0xa2, 0x32, 0xe4,
+    0x92, 0x72, 0xa4, 0x19, 0x16, 0x5e, 0x92, 0x62, 0xfa, 0xb0, 0x0a, 0xaf, 0xc0, 0x8e, 0xfb, 0x38,
+    0xe1, 0x9b, 0xc5, 0x71, 0x9c, 0xaf, 0xd0, 0x73, 0x2f, 0x02, 0x43, 0xf8, 0xbd, 0xf4, 0x7a, 0x90,
+    0x20, 0x88, 0x35, 0x67, 0x0d, 0x6c, 0x19, 0xb1, 0xc0, 0xe4, 0x1d, 0xd5, 0xf7, 0xf4, 0xaf, 0xf5,
+    0x6e, 0x87, 0x91, 0xe2, 0x47, 0x44, 0xe8, 0x42, 0x5d, 0xf6, 0x1e, 0x64, 0x75, 0x32, 0x3d, 0x42,
+    0x76, 0xfa, 0xd2, 0xf8, 0xb2, 0xdf, 0x79, 0x48, 0xbd, 0x19, 0x50, 0x56, 0xed, 0x1f, 0xe9, 0x5c,
+    0xcb, 0xd3, 0x46, 0xbf, 0x6b, 0xcc, 0xa7, 0x96, 0x8b, 0x13, 0x99, 0x3a, 0xca, 0xee, 0x74, 0x60,
+    0xe6, 0x17, 0xdf, 0x69, 0x4f, 0x9d, 0x46, 0x7a, 0x24, 0xc2, 0xe7, 0xf5, 0xce, 0xb1, 0x32, 0x2a,
+    0xc2, 0x4a, 0xa1, 0x06, 0xfa, 0xc4, 0x52, 0x97, 0x4a, 0xb0, 0x80, 0x05, 0x22, 0xc8, 0xdc, 0x83,
+    0x95, 0x80, 0xe4, 0xa8, 0xea, 0xcb, 0xa4, 0x2f, 0xdf, 0xc4, 0xb2, 0x69, 0xec, 0x9b, 0xea, 0xa0,
+    0x86, 0xf8, 0xdf, 0x65, 0xce, 0xb6, 0x2e, 0xeb, 0x02, 0xca, 0xcd, 0xe0, 0xaf, 0x94, 0xb9, 0xac,
+    0x10, 0xc4, 0x59, 0xcd, 0xf7, 0x73, 0x6a, 0x6b, 0x80, 0x71, 0xcf, 0x16, 0xb6, 0x5e, 0x62, 0x91,
+    0xe2, 0xda, 0x0e, 0xe8, 0x88, 0xa5, 0x02, 0xec, 0x4f, 0x11, 0x03, 0xc6, 0x1e, 0xea, 0xfa, 0x2c,
+    0x3d, 0xe3, 0x63, 0xd6, 0x2e, 0x53, 0xe4, 0xb8, 0xc1, 0x63, 0xbe, 0x23, 0x3e, 0xd5, 0x80, 0x1d,
+    0xef, 0xca, 0x4f, 0x10, 0x41, 0x87, 0xa5, 0x24, 0x71, 0xb3, 0x11, 0x30, 0x09, 0x12, 0x48, 0xcf,
+    0x61, 0x6a, 0x28, 0x69, 0x6b, 0xf2, 0x0f, 0x08, 0x96, 0xce, 0x20, 0x5e, 0x0d, 0x48, 0x7c, 0x4a,
+    0x8d, 0x41, 0xbd, 0x67, 0x03, 0x52, 0xa4, 0xb8, 0xfb, 0x52, 0x45, 0x99, 0xbf, 0x98, 0x95, 0x26,
+    0x13, 0x43, 0x51, 0x9e, 0xc4, 0xf2, 0x74, 0x3e, 0x86, 0xc7, 0x85, 0xee, 0xe3, 0x40, 0xc7, 0xf0,
+    0x74, 0x4d, 0xfb, 0x7e, 0x12, 0xdb, 0x43, 0x04, 0xc1, 0xad, 0x52, 0x59, 0x1e, 0xf2, 0x58, 0x0a,
+    0x6c, 0xc8, 0xb6, 0x0a, 0x0f, 0x49, 0xc0, 0xe4, 0xbf, 0x92, 0x24, 0x6d, 0xc3, 0x0e, 0xff, 0xf3,
+    0x3e, 0xee, 0xad, 0x54, 0x89, 0x5a, 0xf0, 0x39, 0x57, 0xde, 0xd0, 0x43, 0xfc, 0x60, 0xec, 0xcc,
+    0xf3, 0xbb, 0xdd, 0x73, 0xe1, 0xf2, 0x7c, 0x48, 0x86, 0x2b, 0x7b, 0xff, 0x03, 0x49, 0x8d, 0x94,
+    0xe7, 0xe9, 0xb8, 0x58, 0x69, 0xfe, 0xe1, 0x30, 0x58, 0x5b, 0xa0, 0x2b, 0x52, 0xcd, 0x28, 0x40,
+    0xc3, 0xa5, 0xb9, 0x8a, 0xc4, 0x3a, 0x27, 0x48, 0xd5, 0x50, 0x41, 0x41, 0x93, 0xfe, 0xcb, 0xf4,
+    0xd2, 0xb7, 0x91, 0x69, 0x6a, 0x8b, 0x92, 0x1a, 0x55, 0xc2, 0x66, 0x13, 0x5c, 0x2b, 0xc7, 0xa5,
+    0x20, 0xb7, 0xa6, 0x15, 0x88, 0xb0, 0x72, 0xeb, 0x48, 0xef, 0x72, 0x77, 0x4d, 0xb8, 0xb0, 0xde,
+    0xfb, 0x49, 0x6c, 0x85, 0xd3, 0x27, 0xe6, 0x9d, 0x97, 0xef, 0x65, 0x3b, 0xa2, 0x0a, 0xfe, 0x7a,
+    0x48, 0x5c, 0x2b, 0xed, 0x82, 0x89, 0xca, 0xde, 0xbc, 0x21, 0x76, 0xba, 0x70, 0xb5, 0x3a, 0x1b,
+    0x46, 0xaa, 0x4a, 0x02, 0xe3, 0x00, 0x2d, 0xdd, 0x97, 0x8a, 0xb4, 0xe9, 0x86, 0xee, 0xf4, 0x3c,
+    0x33, 0x32, 0xcd, 0xb0, 0x3e, 0xd8, 0x1e, 0xde, 0x9a, 0xd6, 0xd0, 0xdf, 0x8a, 0x4f, 0x4c, 0x6f,
+    0x96, 0x2c, 0x7f, 0x0c, 0x9c, 0x84, 0x73, 0x32, 0x86, 0x7c, 0x17, 0xd8, 0x18, 0x3c, 0x5b, 0x85,
+    0x09, 0xd9, 0x19, 0x8c, 0xd3, 0xf6, 0x50, 0x00, 0x02, 0x73, 0xa1, 0xf7, 0x8e, 0x5b, 0x1a, 0x93,
+    0xcb, 0xb7, 0x5a, 0x3d, 0x4f, 0x64, 0xdc, 0xd9, 0x4c, 0x0a, 0x60, 0x57, 0x15, 0xb3, 0xe2, 0x19,
+    0x1b, 0x1b, 0x5c, 0x27, 0x19, 0x4d, 0x8b, 0x25, 0xc2, 0x9f, 0xd9, 0x8e, 0xa6, 0x5b, 0x97, 0xe8,
+    0x01, 0xb2, 0x6b, 0x0c, 0xa6, 0xa3, 0x95, 0x16, 0xa9, 0xb8, 0x26, 0x27, 0x15, 0x60, 0xe1, 0x44,
+    0x8e, 0xbc, 0x8e, 0x14, 0xdf, 0xd5, 0xce, 0x72, 0x4c, 0x66, 0xbc, 0xc2, 0xf4, 0x82, 0xf4, 0x5b,
+    0x53, 0x45, 0xe4, 0x74, 0xb2, 0xe2, 0x74, 0x93, 0x15, 0x4b, 0x44, 0x6f, 0xe6, 0x07, 0xdd, 0x1a,
+    0x78, 0xeb, 0x4b, 0x81, 0x15, 0x5d, 0xc5, 0x3b, 0x5a, 0x0c, 0x6e, 0xaa, 0xbb, 0xc5, 0x8b, 0xf6,
+    0xaa, 0xb0, 0xb4, 0x42, 0x9c, 0x6f, 0x79, 0x94, 0x8d, 0x89, 0x3c, 0x33, 0x17, 0x7f, 0x46, 0xe8,
+    0x43, 0x37, 0xc6, 0x6e, 0xee, 0x35, 0x6d, 0x90, 0x39, 0x59, 0xed, 0x49, 0x83, 0x19, 0xec, 0x86,
+    0x9e, 0x7d, 0x11, 0x51, 0x61, 0xf5, 0xd8, 0x47, 0x90, 0xde, 0xa3, 0x33, 0x18, 0x2d, 0x6f, 0x77,
+    0xe3, 0x53, 0x35, 0x04, 0x87, 0xbe, 0xf4, 0x5d, 0x38, 0x8b, 0xec, 0x09, 0xa3, 0x7f, 0xd9, 0xd1,
+    0xf9, 0xa1, 0x6b, 0x51, 0x9e, 0x7d, 0x27, 0xa4, 0xe1, 0x72, 0xb9, 0xc4, 0x8c, 0x6b, 0xda, 0xe3,
+    0xdc, 0x5b, 0x46, 0x4b, 0x9e, 0xf9, 0xa3, 0xf3, 0x21, 0x32, 0x71, 0xb8, 0xf1, 0x73, 0xc7, 0x77,
+    0xaf, 0x82, 0xf4, 0xc2, 0x37, 0x4e, 0x25, 0x4b, 0x6e, 0x5d, 0xe2, 0xb6, 0x5d, 0x38, 0x14, 0x63,
+    0x94, 0xb2, 0x90, 0xa2, 0xae, 0x47, 0xfa, 0xff, 0x5d, 0xd9, 0x8e, 0xd6, 0x9e, 0x7e, 0x05, 0xd3,
+    0x88, 0x13, 0xe4, 0x69, 0x0d, 0x89, 0x63, 0x76, 0x39, 0xa3, 0x25, 0x7f, 0x38, 0xfa, 0xe5, 0x7d,
+    0x78, 0x8d, 0x65, 0xb3, 0xbf, 0x65, 0xf4, 0x79, 0x15, 0x1f, 0x20, 0xb8, 0xd0, 0xa5, 0x69, 0x51,
+    0x21, 0xed, 0x7f, 0x92, 0xff, 0x96, 0x83, 0xc1, 0x64, 0xbc, 0x4b, 0x54, 0xd4, 0xa4, 0x4c, 0x41,
+    0x67, 0x58, 0x39, 0xb7, 0xa0, 0xbb, 0xc0, 0x8f, 0x4f, 0xfe, 0x83, 0x88, 0xdc, 0x50, 0xaa, 0xfb,
+};
+
+static const uint8_t fixture_target[] = {
+    0xe9, 0x67, 0x02, 0xdd, 0x1d, 0x41, 0xf4, 0x15, 0x57, 0xdb, 0x7c, 0xd1, 0x67, 0x0e, 0x71, 0x49,
+    0x42, 0x6e, 0xf7, 0xc7, 0xba, 0x7c, 0x0f, 0x0f, 0x96, 0x3f, 0x16, 0x03, 0xed, 0xa0, 0xa3, 0xd8,
+    0xdd, 0x66, 0x1c, 0x80, 0x65, 0xc4, 0xdb, 0x4f, 0x1e, 0x32, 0x26, 0x40, 0x16, 0x18, 0xd0, 0x6f,
+    0xbd, 0x2e, 0xa7, 0x35, 0xd0, 0x17, 0xd7, 0xea, 0x26, 0x14, 0xb4, 0x31, 0x7a, 0x29, 0x44, 0x8d,
+    0xb2, 0xdf, 0xb1, 0xf0, 0xc7, 0x10, 0x16, 0x4d, 0x04, 0x39, 0xf3, 0x11, 0x5d, 0x11, 0x09, 0xdb,
+    0x18, 0x95, 0xdb, 0x53, 0x20, 0x95, 0x56, 0x32, 0x22, 0x10, 0x0a, 0xd8, 0x0b, 0x8d, 0xfb, 0xa4,
+    0xca, 0x0e, 0x33, 0x38, 0x69, 0xe1, 0x79, 0x9c, 0x77, 0x4a, 0xc5, 0xcd, 0xa1, 0x29, 0x21, 0x4f,
+    0x16, 0x0c, 0x49, 0xcb, 0x7c, 0xa5, 0x22, 0x66, 0x8f, 0xa5, 0xde, 0xf0, 0x6f, 0xff, 0x7a, 0x03,
+    0x33, 0x35, 0x0b, 0x6d, 0x6c, 0x32, 0x49, 0x44, 0x13, 0x54, 0x54, 0x1c, 0x1b, 0xc6, 0xf8, 0x3b,
+    0xd5, 0x69, 0xaf, 0x55, 0x76, 0x1e, 0x07, 0x9b, 0x85, 0xd5, 0x63, 0xe0, 0xfc, 0xa6, 0x83, 0x8c,
+    0x95, 0xf2, 0x19, 0x86, 0xcf, 0x1d, 0x1b, 0x9d, 0x5f, 0x97, 0x76, 0x70, 0x80, 0xd6, 0x0e, 0xa3,
+    0x6b, 0xef, 0x97, 0x30, 0x06, 0x32, 0x00, 0x1e, 0x24, 0x44, 0xc2, 0x2a, 0xb5, 0x3c, 0xf7, 0xca,
+    0xfd, 0x61, 0xd5, 0x80, 0x85, 0x33, 0xfb, 0x23, 0xbc, 0xef, 0x71, 0x88, 0x48, 0x37, 0x9a, 0x70,
+    0xb3, 0x45, 0xfe, 0x18, 0xef, 0x37, 0xe4, 0xf7, 0x98, 0x72, 0xe3, 0xe2, 0xf6, 0x69, 0x53, 0x28,
+    0x8d, 0x27, 0x77, 0x63, 0x10, 0x36, 0x8a, 0x7d, 0xeb, 0x3c, 0x5a, 0xb4, 0xd3, 0xe1, 0xd8, 0x64,
+    0x8d, 0x6e, 0x33, 0x43, 0xcb, 0x98, 0xf9, 0x22, 0xe6, 0x10, 0x9a, 0x4a, 0xbb, 0xfe, 0xb8, 0xb5,
+    0x08, 0xad, 0xd4, 0x0d, 0x05, 0xb9, 0x51, 0xb2, 0xbb, 0x7b, 0x47, 0x1e, 0xb5, 0xd2, 0x28, 0x49,
+    0x07, 0x77, 0xf0, 0xfc, 0x51, 0x49, 0x35, 0xc0, 0xc9, 0x83, 0x1b, 0x9e, 0xd4, 0x96, 0xfc, 0xcb,
+    0x68, 0x1c, 0xe7, 0x8c, 0x52, 0x7d, 0x4c, 0x4d, 0xbd, 0x0c, 0xb5, 0xfd, 0x69, 0x6e, 0x73, 0x65,
+    0x72, 0x74, 0x65, 0x64, 0x20, 0x6c, 0x69, 0x74, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x64, 0x61, 0x74,
+    0x61, 0x35, 0x52, 0xb8, 0xb5, 0xaa, 0xc7, 0xf8, 0x8d, 0x93, 0xd8, 0xa1, 0xd4, 0xff, 0x92, 0x9e,
+    0x8c, 0xc7, 0x8f, 0xf1, 0xf9, 0xb6, 0x93, 0x1e, 0xb7, 0xcc, 0x87, 0x5d, 0x78, 0x6c, 0xf4, 0x67,
+    0x21, 0x2b, 0xbb, 0x4f, 0x63, 0xf6, 0xae, 0x1e, 0xfc, 0x82, 0x79, 0x9b, 0xda, 0x54, 0x12, 0xc2,
+    0x67, 0x14, 0x1d, 0xaf, 0xae, 0x60, 0xbb, 0xc7, 0xd0, 0x95, 0x18, 0x29, 0x29, 0xa7, 0xb4, 0x27,
+    0xed, 0x01, 0x88, 0x0f, 0x86, 0x3c, 0x83, 0xef, 0xb8, 0x9b, 0xe3, 0x9a, 0xe3, 0xab, 0x9a, 0x87,
+    0x50, 0x9c, 0x8b, 0xff, 0x04, 0xb2, 0x37, 0x21, 0xbc, 0x1f, 0x2e, 0x17, 0xc2, 0x78, 0xff, 0x1e,
+    0xd5, 0x26, 0xd0, 0x71, 0x77, 0xfb, 0x96, 0xf2, 0x34, 0x92, 0x57, 0x2e, 0x0b, 0x34, 0x0c, 0x96,
+    0x4b, 0x4e, 0xac, 0x98, 0x08, 0x6c, 0x5a, 0x1a, 0x98, 0xe0, 0x72, 0x66, 0x65, 0x92, 0x5d, 0x24,
+    0x3e, 0x39, 0xd6, 0x00, 0x1f, 0xdb, 0xb1, 0x5e, 0x85, 0x95, 0x06, 0xc8, 0x90, 0x4a, 0xdb, 0xb7,
+    0x05, 0xb5, 0x1c, 0xa4, 0xf0, 0xdd, 0xe6, 0x9c, 0x42, 0x6d, 0x39, 0x86, 0xf4, 0xb9, 0x7b, 0x04,
+    0x41, 0x41, 0x19, 0x20, 0xba, 0xdd, 0x43, 0x43, 0x49, 0x89, 0x9f, 0x2c, 0x48, 0xad, 0xce, 0x62,
+    0xa9, 0x67, 0x5a, 0xaf, 0xe9, 0x67, 0x69, 0xdd, 0x1d, 0x41, 0xf4, 0x15, 0x57, 0xdb, 0x7c, 0xd1,
+    0x67, 0x0e, 0x71, 0x49, 0x42, 0x6e, 0xf7, 0xc7, 0xba, 0x7c, 0x0f, 0x0f, 0x96, 0x3f, 0x16, 0x03,
+    0xed, 0xa0, 0xa3, 0xd8, 0xdd, 0x66, 0x1c, 0x80, 0x65, 0xc4, 0xdb, 0x4f, 0x1e, 0x32, 0x26, 0x40,
+    0x16, 0x18, 0xd0, 0x6f, 0xbd, 0x2e, 0xa7, 0x35, 0xd0, 0x17, 0xd7, 0xea, 0x26, 0x14, 0xb4, 0x31,
+    0x7a, 0x29, 0x44, 0x8d, 0x47, 0xc7, 0xf3, 0xbb, 0x22, 0xcc, 0x8c, 0x26, 0x1e, 0x06, 0xc3, 0x91,
+    0x62, 0x16, 0xa2, 0x32, 0xe4, 0x92, 0x72, 0xa4, 0x19, 0x16, 0x5e, 0x92, 0x62, 0xfa, 0xb0, 0x0a,
+    0xaf, 0xc0, 0x8e, 0xfb, 0x38, 0xe1, 0x9b, 0xc5, 0x71, 0x9c, 0xaf, 0xd0, 0x73, 0x2f, 0x02, 0x43,
+    0xf8, 0xbd, 0xf4, 0x7a, 0x90, 0x20, 0x88, 0x35, 0x67, 0x0d, 0x6c, 0x19, 0xb1, 0xc0, 0xe4, 0x1d,
+    0xd5, 0xf7, 0xf4, 0xaf, 0xf5, 0x6e, 0x87, 0x91, 0xe2, 0x47, 0x44, 0xe8, 0x42, 0x5d, 0xf6, 0x1e,
+    0x64, 0x75, 0x32, 0x3d, 0x42, 0x76, 0xfa, 0xd2, 0xf8, 0xb2, 0xdf, 0x79, 0x48, 0xbd, 0x19, 0x50,
+    0x56, 0xed, 0x1f, 0xe9, 0x5c, 0xcb, 0xd3, 0x46, 0xbf, 0x6b, 0xcc, 0xa7, 0x96, 0x8b, 0x13, 0x99,
+    0x3a, 0xca, 0xee, 0x74, 0x60, 0xe6, 0x17, 0xdf, 0x69, 0x4f, 0x9d, 0x46, 0x7a, 0x24, 0xc2, 0xe7,
+    0xf5, 0xce, 0xb1, 0x32, 0x2a, 0xc2, 0x4a, 0xa1, 0x06, 0xfa, 0xc4, 0x52, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x88, 0xa5, 0x02, 0xec, 0x4f, 0x11, 0x03,
+    0xc6, 0x1e, 0xea, 0xfa, 0x2c, 0x3d, 0xe3, 0x63, 0xd6, 0x2e, 0x53, 0xe4, 0xb8, 0xc1, 0x63, 0xbe,
+    0x23, 0x3e, 0xd5, 0x80, 0x1d, 0xef, 0xca, 0x4f, 0x10, 0x41, 0x87, 0xa5, 0x24, 0x71, 0xb3, 0x11,
+    0x30, 0x09, 0x12, 0x48, 0xcf, 0x61, 0x6a, 0x28, 0x69, 0x6b, 0xf2, 0x0f, 0x08, 0x96, 0xce, 0x20,
+    0x5e, 0x0d, 0x48, 0x7c, 0x4a, 0x8d, 0x41, 0xbd, 0x67, 0x03, 0x52, 0xa4, 0xb8, 0xfb, 0x52, 0x45,
+    0x99, 0xbf, 0x98, 0x95, 0x26, 0x13, 0x43, 0x51, 0x9e, 0xc4, 0xf2, 0x74, 0x3e, 0x86, 0xc7, 0x85,
+    0xee, 0xe3, 0x40, 0xc7, 0xf0, 0x74, 0x4d, 0xfb, 0x7e, 0x12, 0xdb, 0x43, 0x04, 0xc1, 0xad, 0x52,
+    0x59, 0x1e, 0xf2, 0x58, 0x0a, 0x6c, 0xc8, 0xb6, 0x0a, 0x0f, 0x49, 0xc0, 0xe4, 0xbf, 0x92, 0x24,
+    0x6d, 0xc3, 0x0e, 0xff, 0xf3, 0x3e, 0xee, 0xad, 0x54, 0x89, 0x5a, 0xf0, 0x39, 0x57, 0xde, 0xd0,
+    0x43, 0xfc, 0x60, 0xec, 0xcc, 0xf3, 0xbb, 0xdd, 0x73, 0xe1, 0xf2, 0x7c, 0x48, 0x86, 0x2b, 0x7b,
+    0xff, 0x03, 0x49, 0x8d, 0x94, 0xe7, 0xe9, 0xb8, 0x58, 0x69, 0xfe, 0xe1, 0x30, 0x58, 0x5b, 0xa0,
+    0x2b, 0x52, 0xcd, 0x28, 0x40, 0xc3, 0xa5, 0xb9, 0x8a, 0xc4, 0x3a, 0x27, 0x48, 0xd5, 0x50, 0x41,
+    0x41, 0x93, 0xfe, 0xcb, 0xf4, 0xd2, 0xb7, 0x91, 0x69, 0x6a, 0x8b, 0x92, 0x1a, 0x55, 0xc2, 0x66,
+    0x13, 0x5c, 0x2b, 0xc7, 0xa5, 0x20, 0xb7, 0xa6, 0x15, 0x88, 0xb0, 0x72, 0xeb, 0x48, 0xef, 0x72,
+    0x77, 0x4d, 0xb8, 0xb0, 0xde, 0xfb, 0x49, 0x6c, 0x85, 0xd3, 0x27, 0xe6, 0x9d, 0x97, 0xef, 0x65,
+    0x3b, 0xa2, 0x0a, 0xfe, 0x7a, 0x48, 0x5c, 0x2b, 0xdf, 0x8a, 0x4f, 0x4c, 0x6f, 0x96, 0x2c, 0x7f,
+    0x0c, 0x9c, 0x84, 0x73, 0x32, 0x86, 0x7c, 0x17, 0xd8, 0x18, 0x3c, 0x5b, 0x85, 0x09, 0xd9, 0x19,
+    0x8c, 0xd3, 0xf6, 0x50, 0x00, 0x02, 0x73, 0xa1, 0xf7, 0x8e, 0x5b, 0x1a, 0x93, 0xcb, 0xb7, 0x5a,
+    0x3d, 0x4f, 0x64, 0xdc, 0xd9, 0x4c, 0x0a, 0x60, 0x57, 0x15, 0xb3, 0xe2, 0x19, 0x1b, 0x1b, 0x5c,
+    0x27, 0x19, 0x4d, 0x8b, 0x25, 0xc2, 0x9f, 0xd9, 0x8e, 0xa6, 0x5b, 0x97, 0xe8, 0x01, 0xb2, 0x6b,
+    0x0c, 0xa6, 0xa3, 0x95, 0x16, 0xa9, 0xb8, 0x26, 0x27, 0x15, 0x60, 0xe1, 0x44, 0x8e, 0xbc, 0x8e,
+    0x14, 0xdf, 0xd5, 0xce, 0x72, 0x4c, 0x66, 0xbc, 0xc2, 0xf4, 0x82, 0xf4, 0x5b, 0x53, 0x45, 0xe4,
+    0x74, 0xb2, 0xe2, 0x74, 0x93, 0x15, 0x4b, 0x44, 0x6f, 0xe6, 0x07, 0xdd, 0x1a, 0x78, 0xeb, 0x4b,
+    0x81, 0x15, 0x5d, 0xc5, 0x3b, 0x5a, 0x0c, 0x6e, 0xaa, 0xbb, 0xc5, 0x8b, 0xf6, 0xaa, 0xb0, 0xb4,
+    0x42, 0x9c, 0x6f, 0x79, 0x94, 0x8d, 0x89, 0x3c, 0x33, 0x17, 0x7f, 0x46, 0xe8, 0x43, 0x37, 0xc6,
+    0x6e, 0xee, 0x35, 0x6d, 0x90, 0x39, 0x59, 0xed, 0x49, 0x83, 0x19, 0xec, 0x86, 0x9e, 0x7d, 0x11,
+    0x51, 0x61, 0xf5, 0xd8, 0x47, 0x90, 0xde, 0xa3, 0x33, 0x18, 0x2d, 0x6f, 0x77, 0xe3, 0x53, 0x35,
+    0x04, 0x87, 0xbe, 0xf4, 0x5d, 0x38, 0x8b, 0xec, 0x09, 0xa3, 0x7f, 0xd9, 0xd1, 0xf9, 0xa1, 0x6b,
+    0x51, 0x9e, 0x7d, 0x27, 0xa4, 0xe1, 0x72, 0xb9, 0xc4, 0x8c, 0x6b, 0xda, 0xe3, 0xdc, 0x5b, 0x46,
+    0x4b, 0x9e, 0xf9, 0xa3, 0xf3, 0x21, 0x32, 0x71, 0xb8, 0xf1, 0x73, 0xc7, 0x77, 0xaf, 0x82, 0xf4,
+    0xc2, 0x37, 0x4e, 0x25, 0x4b, 0x6e, 0x5d, 0xe2, 0xb6, 0x5d, 0x38, 0x14, 0x63, 0x94, 0xb2, 0x90,
+    0xa2, 0xae, 0x47, 0xfa, 0xff, 0x5d, 0xd9, 0x8e, 0xd6, 0x9e, 0x7e, 0x05, 0xd3, 0x88, 0x13, 0xe4,
+    0x69, 0x0d, 0x89, 0x63, 0x76, 0x39, 0xa3, 0x25, 0x7f, 0x38, 0xfa, 0xe5, 0x7d, 0x78, 0x8d, 0x65,
+    0xb3, 0xbf, 0x65, 0xf4, 0x79, 0x15, 0x1f, 0x20, 0xb8, 0xd0, 0xa5, 0x69, 0x51, 0x21, 0xed, 0x7f,
+    0x92, 0xff, 0x96, 0x83, 0xc1, 0x64, 0xbc, 0x4b, 0x54, 0xd4, 0xa4, 0x4c, 0x41, 0x67, 0x58, 0x39,
+    0xb7, 0xa0, 0xbb, 0xc0, 0x8f, 0x4f, 0xfe, 0x83, 0x88, 0xdc, 0x50, 0xaa, 0xfb, 0xa2, 0xde, 0x21,
+    0x24, 0xd8, 0x7b, 0x7c, 0x5f, 0x6d, 0x46, 0xea, 0x2e, 0xac, 0x99, 0x30, 0x74, 0x8b, 0xe8, 0x6e,
+    0xa4, 0xc9, 0x8a, 0x24, 0x82, 0x39, 0xc5, 0x81, 0x55, 0xbb, 0xfc, 0xe6, 0xb2, 0x75, 0xbe, 0xcb,
+    0x71, 0x39, 0x9a, 0x2c, 0xcf, 0xd4, 0xad, 0xf8, 0x75, 0xd5, 0x47, 0x33, 0xa9, 0xc2, 0x06, 0x1c,
+    0xbd, 0xd2, 0x2d, 0xd6, 0x9a, 0xc9, 0x69, 0xe5, 0xc3, 0x5a, 0xfb, 0x3e, 0x22, 0x19, 0xd9, 0x4c,
+    0x15, 0x9a, 0x88, 0xb2, 0x9b, 0xb1, 0x65, 0x77, 0x72, 0x16, 0xb6, 0x58, 0x6c, 0xbd, 0x82, 0xa2,
+    0xad, 0x7b, 0x0b, 0x00, 0xf9, 0x09, 0x2f, 0x48, 0xc0, 0x50, 0x45, 0xff, 0xcf, 0x83, 0xef, 0x54,
+    0x70,
+};
+
+static const uint8_t fixture_delta[] = {
+    0x4c, 0x53, 0x44, 0x31, 0x00, 0x05, 0x00, 0x00, 0x91, 0x05, 0x00, 0x00, 0x95, 0x9b, 0x2f, 0x3b,
+    0x36, 0x59, 0xeb, 0x64, 0x75, 0x69, 0xdb, 0x78, 0x77, 0x4f, 0x0d, 0x2b, 0x25, 0x9b, 0x1e, 0xd0,
+    0xbf, 0xfc, 0x5b, 0x75, 0xdc, 0x32, 0x99, 0xe2, 0x45, 0x36, 0xd9, 0x23, 0x49, 0x10, 0x00, 0x00,
+    0x00, 0xe9, 0x67, 0x02, 0xdd, 0x1d, 0x41, 0xf4, 0x15, 0x57, 0xdb, 0x7c, 0xd1, 0x67, 0x0e, 0x71,
+    0x49, 0x43, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x49, 0x15, 0x00, 0x00, 0x00, 0x69,
+    0x6e, 0x73, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x6c, 0x69, 0x74, 0x65, 0x72, 0x61, 0x6c, 0x20,
+    0x64, 0x61, 0x74, 0x61, 0x43, 0x2c, 0x01, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x49, 0x10, 0x00,
+    0x00, 0x00, 0xe9, 0x67, 0x69, 0xdd, 0x1d, 0x41, 0xf4, 0x15, 0x57, 0xdb, 0x7c, 0xd1, 0x67, 0x0e,
+    0x71, 0x49, 0x43, 0x10, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x43, 0xdf, 0x01, 0x00, 0x00,
+    0x88, 0x00, 0x00, 0x00, 0x49, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xa3, 0x02, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x43, 0xbb,
+    0x03, 0x00, 0x00, 0x45, 0x01, 0x00, 0x00, 0x49, 0x64, 0x00, 0x00, 0x00, 0xa2, 0xde, 0x21, 0x24,
+    0xd8, 0x7b, 0x7c, 0x5f, 0x6d, 0x46, 0xea, 0x2e, 0xac, 0x99, 0x30, 0x74, 0x8b, 0xe8, 0x6e, 0xa4,
+    0xc9, 0x8a, 0x24, 0x82, 0x39, 0xc5, 0x81, 0x55, 0xbb, 0xfc, 0xe6, 0xb2, 0x75, 0xbe, 0xcb, 0x71,
+    0x39, 0x9a, 0x2c, 0xcf, 0xd4, 0xad, 0xf8, 0x75, 0xd5, 0x47, 0x33, 0xa9, 0xc2, 0x06, 0x1c, 0xbd,
+    0xd2, 0x2d, 0xd6, 0x9a, 0xc9, 0x69, 0xe5, 0xc3, 0x5a, 0xfb, 0x3e, 0x22, 0x19, 0xd9, 0x4c, 0x15,
+    0x9a, 0x88, 0xb2, 0x9b, 0xb1, 0x65, 0x77, 0x72, 0x16, 0xb6, 0x58, 0x6c, 0xbd, 0x82, 0xa2, 0xad,
+    0x7b, 0x0b, 0x00, 0xf9, 0x09, 0x2f, 0x48, 0xc0, 0x50, 0x45, 0xff, 0xcf, 0x83, 0xef, 0x54, 0x70,
+    0x45,
+};
@@ -0,0 +1,219 @@
+#include <string.h>
+#include <unity.h>
+#include <vector>
+
+#include "delta_decoder.h"
+#include "delta_fixture.h"
+
+using lightsaber::DeltaDecoder;
+using lightsaber::DeltaHeader;
+using lightsaber::DeltaSink;
+
+// rebuilds the target in RAM, copies come from the fixture base
+struct TestSink : public DeltaSink {
+    bool beginDelta(const DeltaHeader& header) override
+    {
+        m_header = header;
+        ++m_begin_count;
+        return m_accept;
+    }
+    bool copy(uint32_t offset, uint32_t length) override
+    {
+        if (offset < DeltaDecoder::HEADER_LITERAL
+            || length > sizeof(fixture_base)
+            || offset > sizeof(fixture_base) - length) {
+            return false;
+        }
+        m_output.insert(m_output.end(), fixture_base + offset, fixture_base + offset + length);
+        return true;
+    }
+    bool insert(const uint8_t* data, size_t size) override
+    {
+        m_output.insert(m_output.end(), data, data + size);
+        return true;
+    }
+
+    DeltaHeader m_header;
+    int m_begin_count{ 0 };
+    bool m_accept{ true };
+    std::vector<uint8_t> m_output;
+};
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+static void assertTarget(const TestSink& sink)
+{
+    TEST_ASSERT_EQUAL_UINT32(sizeof(fixture_target), sink.m_output.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(fixture_target, sink.m_output.data(), sizeof(fixture_target));
+}
+
+static uint32_t next(uint32_t& state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+void test_whole_image()
+{
+    TestSink sink;
+    DeltaDecoder decoder(sink);
+
+    TEST_ASSERT_TRUE(decoder.write(fixture_delta, sizeof(fixture_delta)));
+    TEST_ASSERT_TRUE(decoder.finished());
+    TEST_ASSERT_EQUAL(1, sink.m_begin_count);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(fixture_base), sink.m_header.source_size);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(fixture_target), sink.m_header.target_size);
+    assertTarget(sink);
+}
+
+void test_byte_by_byte()
+{
+    TestSink sink;
+    DeltaDecoder decoder(sink);
+
+    for (size_t index = 0; index < sizeof(fixture_delta); ++index) {
+        TEST_ASSERT_TRUE(decoder.write(fixture_delta + index, 1));
+    }
+    TEST_ASSERT_TRUE(decoder.finished());
+    assertTarget(sink);
+}
+
+void test_random_chunks()
+{
+    for (uint32_t seed = 1; seed <= 200; ++seed) {
+        TestSink sink;
+        DeltaDecoder decoder(sink);
+        uint32_t state(seed);
+
+        size_t offset(0);
+        while (offset < sizeof(fixture_delta)) {
+            size_t chunk(1 + next(state) % 64);
+            if (chunk > sizeof(fixture_delta) - offset) {
+                chunk = sizeof(fixture_delta) - offset;
+            }
+            TEST_ASSERT_TRUE(decoder.write(fixture_delta + offset, chunk));
+            offset += chunk;
+        }
+        TEST_ASSERT_TRUE(decoder.finished());
+        assertTarget(sink);
+    }
+}
+
+void test_reset_between_uploads()
+{
+    TestSink sink;
+    DeltaDecoder decoder(sink);
+
+    TEST_ASSERT_TRUE(decoder.write(fixture_delta, 100));
+    decoder.reset();
+    sink.m_output.clear();
+    TEST_ASSERT_TRUE(decoder.write(fixture_delta, sizeof(fixture_delta)));
+    TEST_ASSERT_TRUE(decoder.finished());
+    assertTarget(sink);
+}
+
+void test_truncated()
+{
+    TestSink sink;
+    DeltaDecoder decoder(sink);
+
+    TEST_ASSERT_TRUE(decoder.write(fixture_delta, sizeof(fixture_delta) - 1));
+    TEST_ASSERT_FALSE(decoder.finished());
+}
+
+void test_trailing_data()
+{
+    TestSink sink;
+    DeltaDecoder decoder(sink);
+    std::vector<uint8_t> data(fixture_delta, fixture_delta + sizeof(fixture_delta));
+    data.push_back(0);
+
+    TEST_ASSERT_FALSE(decoder.write(data.data(), data.size()));
+    TEST_ASSERT_NOT_NULL(decoder.error());
+}
+
+void test_bad_magic()
+{
+    TestSink sink;
+    DeltaDecoder decoder(sink);
+    std::vector<uint8_t> data(fixture_delta, fixture_delta + sizeof(fixture_delta));
+    data[0] = 'X';
+
+    TEST_ASSERT_FALSE(decoder.write(data.data(), data.size()));
+    TEST_ASSERT_NOT_NULL(decoder.error());
+    TEST_ASSERT_EQUAL(0, sink.m_begin_count);
+}
+
+void test_sink_rejects_base()
+{
+    TestSink sink;
+    sink.m_accept = false;
+    DeltaDecoder decoder(sink);
+
+    TEST_ASSERT_FALSE(decoder.write(fixture_delta, sizeof(fixture_delta)));
+    TEST_ASSERT_NULL(decoder.error());
+    TEST_ASSERT_TRUE(sink.m_output.empty());
+    // stays failed for the rest of the upload
+    TEST_ASSERT_FALSE(decoder.write(fixture_delta, 1));
+}
+
+void test_wrapping_copy()
+{
+    TestSink sink;
+    DeltaDecoder decoder(sink);
+    // offset + length wraps to 0x10 in 32 bit
+    static const uint8_t op[] = { 'C', 0xf0, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 'E' };
+
+    TEST_ASSERT_TRUE(decoder.write(fixture_delta, DeltaDecoder::HEADER_SIZE));
+    TEST_ASSERT_FALSE(decoder.write(op, sizeof(op)));
+    TEST_ASSERT_NULL(decoder.error());
+    TEST_ASSERT_TRUE(sink.m_output.empty());
+}
+
+void test_no_header_copy()
+{
+    // make_delta never copies the image header, the patched bytes stay literal
+    for (size_t pos = DeltaDecoder::HEADER_SIZE; pos < sizeof(fixture_delta) - 1;) {
+        uint8_t op(fixture_delta[pos]);
+        uint32_t first(fixture_delta[pos + 1] | (fixture_delta[pos + 2] << 8)
+            | (fixture_delta[pos + 3] << 16) | (static_cast<uint32_t>(fixture_delta[pos + 4]) << 24));
+        if (op == 'C') {
+            TEST_ASSERT_TRUE(first >= DeltaDecoder::HEADER_LITERAL);
+            pos += 9;
+        } else {
+            TEST_ASSERT_EQUAL('I', op);
+            pos += 5 + first;
+        }
+    }
+
+    TestSink sink;
+    DeltaDecoder decoder(sink);
+    static const uint8_t op[] = { 'C', 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 'E' };
+    TEST_ASSERT_TRUE(decoder.write(fixture_delta, DeltaDecoder::HEADER_SIZE));
+    TEST_ASSERT_FALSE(decoder.write(op, sizeof(op)));
+    TEST_ASSERT_TRUE(sink.m_output.empty());
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_whole_image);
+    RUN_TEST(test_byte_by_byte);
+    RUN_TEST(test_random_chunks);
+    RUN_TEST(test_reset_between_uploads);
+    RUN_TEST(test_truncated);
+    RUN_TEST(test_trailing_data);
+    RUN_TEST(test_bad_magic);
+    RUN_TEST(test_sink_rejects_base);
+    RUN_TEST(test_wrapping_copy);
+    RUN_TEST(test_no_header_copy);
+    return UNITY_END();
+}
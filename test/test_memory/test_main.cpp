@@ -0,0 +1,143 @@
+#include <memory>
+#include <unity.h>
+#include <vector>
+
+#include "../test_delta/delta_fixture.h"
+#include "alloc_tracker.h"
+#include "delta_decoder.h"
+#include "shimmer.h"
+
+using lightsaber::AllocScope;
+using lightsaber::AllocStats;
+using lightsaber::AllocTracker;
+using lightsaber::DeltaDecoder;
+using lightsaber::DeltaHeader;
+using lightsaber::DeltaSink;
+using lightsaber::Shimmer;
+
+// rebuilds the target into a buffer reserved in beginDelta(), under its own scope
+struct ReserveSink : public DeltaSink {
+    bool beginDelta(const DeltaHeader& header) override
+    {
+        AllocScope scope("sink");
+        m_output.reserve(header.target_size);
+        return true;
+    }
+    bool copy(uint32_t offset, uint32_t length) override
+    {
+        AllocScope scope("sink");
+        m_output.insert(m_output.end(), fixture_base + offset, fixture_base + offset + length);
+        return true;
+    }
+    bool insert(const uint8_t* data, size_t size) override
+    {
+        AllocScope scope("sink");
+        m_output.insert(m_output.end(), data, data + size);
+        return true;
+    }
+
+    std::vector<uint8_t> m_output;
+};
+
+void setUp()
+{
+    AllocTracker::reset();
+}
+
+void tearDown()
+{
+    AllocTracker::report();
+}
+
+static void assertNoAllocations(const char* path)
+{
+    AllocStats stats(AllocTracker::stats(path));
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, stats.allocations, path);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, stats.bytes, path);
+}
+
+void test_nested_paths()
+{
+    {
+        AllocScope outer("outer");
+        std::unique_ptr<uint8_t[]> first(new uint8_t[100]);
+        {
+            AllocScope inner("inner");
+            std::unique_ptr<uint8_t[]> second(new uint8_t[30]);
+        }
+        AllocStats stats(AllocTracker::stats("outer"));
+        TEST_ASSERT_EQUAL_UINT32(1, stats.allocations);
+        TEST_ASSERT_EQUAL_UINT32(100, stats.bytes);
+        TEST_ASSERT_EQUAL_INT32(100, stats.live);
+    }
+    AllocStats outer(AllocTracker::stats("outer"));
+    TEST_ASSERT_EQUAL_UINT32(1, outer.frees);
+    TEST_ASSERT_EQUAL_INT32(0, outer.live);
+    TEST_ASSERT_EQUAL_INT32(100, outer.peak);
+
+    AllocStats inner(AllocTracker::stats("outer/inner"));
+    TEST_ASSERT_EQUAL_UINT32(1, inner.allocations);
+    TEST_ASSERT_EQUAL_UINT32(1, inner.frees);
+    TEST_ASSERT_EQUAL_UINT32(30, inner.bytes);
+    TEST_ASSERT_EQUAL_INT32(0, inner.live);
+
+    assertNoAllocations("inner");
+}
+
+// the decoder streams, only the sink may touch the heap
+void test_delta_decoder()
+{
+    ReserveSink sink;
+    {
+        AllocScope scope("delta");
+        DeltaDecoder decoder(sink);
+        for (size_t pos = 0; pos < sizeof(fixture_delta); pos += 7) {
+            size_t size(sizeof(fixture_delta) - pos < 7 ? sizeof(fixture_delta) - pos : 7);
+            TEST_ASSERT_TRUE(decoder.write(fixture_delta + pos, size));
+        }
+        TEST_ASSERT_TRUE(decoder.finished());
+    }
+    TEST_ASSERT_EQUAL_UINT32(sizeof(fixture_target), sink.m_output.size());
+
+    assertNoAllocations("delta");
+    AllocStats stats(AllocTracker::stats("delta/sink"));
+    TEST_ASSERT_EQUAL_UINT32(1, stats.allocations);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(fixture_target), stats.bytes);
+}
+
+// Shimmer keeps its tables inline, rendering and reseeding never allocate
+void test_shimmer()
+{
+    uint8_t frame[150 * 3];
+    {
+        AllocScope scope("shimmer");
+        std::unique_ptr<Shimmer> shimmer(new Shimmer());
+        {
+            AllocScope render("render");
+            for (uint16_t index = 0; index < 200; ++index) {
+                if (index == 100) {
+                    shimmer->setEffect(Shimmer::Effect::Unstable);
+                    shimmer->lockup();
+                }
+                shimmer->render(0x10, 0x40, 0xff, frame, 150);
+            }
+            shimmer->seed(1);
+        }
+    }
+    AllocStats stats(AllocTracker::stats("shimmer"));
+    TEST_ASSERT_EQUAL_UINT32(1, stats.allocations);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(Shimmer), stats.bytes);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.frees);
+    TEST_ASSERT_EQUAL_INT32(0, stats.live);
+
+    assertNoAllocations("shimmer/render");
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_nested_paths);
+    RUN_TEST(test_delta_decoder);
+    RUN_TEST(test_shimmer);
+    return UNITY_END();
+}
@@ -0,0 +1,108 @@
+#include <unity.h>
+
+#include "shimmer.h"
+
+using lightsaber::Shimmer;
+
+static const uint16_t PIXELS = 150;
+static const uint16_t FRAMES = 200;
+
+// golden frame hashes for DEFAULT_SEED, update only on an intended change of the look
+static const uint32_t FLICKER_HASH = 0xe12581a2;
+static const uint32_t UNSTABLE_HASH = 0x15fec13b;
+static const uint32_t LOCKUP_HASH = 0x5577c857;
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+// FNV-1a over FRAMES frames of a PIXELS blade
+static uint32_t frameHash(Shimmer& shimmer, bool lockup)
+{
+    uint8_t frame[PIXELS * 3];
+    uint32_t hash(2166136261u);
+    for (uint16_t index = 0; index < FRAMES; ++index) {
+        if (lockup && index % 50 == 0) {
+            shimmer.lockup();
+        }
+        shimmer.render(0x10, 0x40, 0xff, frame, PIXELS);
+        for (uint16_t byte = 0; byte < sizeof(frame); ++byte) {
+            hash = (hash ^ frame[byte]) * 16777619u;
+        }
+    }
+    return hash;
+}
+
+static uint32_t effectHash(Shimmer::Effect effect, bool lockup, uint32_t seed = Shimmer::DEFAULT_SEED)
+{
+    Shimmer shimmer(seed);
+    shimmer.setEffect(effect);
+    return frameHash(shimmer, lockup);
+}
+
+void test_flicker_golden()
+{
+    TEST_ASSERT_EQUAL_HEX32(FLICKER_HASH, effectHash(Shimmer::Effect::Flicker, false));
+}
+
+void test_unstable_golden()
+{
+    TEST_ASSERT_EQUAL_HEX32(UNSTABLE_HASH, effectHash(Shimmer::Effect::Unstable, false));
+}
+
+void test_lockup_golden()
+{
+    TEST_ASSERT_EQUAL_HEX32(LOCKUP_HASH, effectHash(Shimmer::Effect::Flicker, true));
+}
+
+void test_reseed_restarts()
+{
+    Shimmer shimmer;
+    uint32_t first(frameHash(shimmer, false));
+    shimmer.seed(Shimmer::DEFAULT_SEED);
+    TEST_ASSERT_EQUAL_HEX32(first, frameHash(shimmer, false));
+}
+
+void test_other_seed_differs()
+{
+    TEST_ASSERT_NOT_EQUAL(effectHash(Shimmer::Effect::Flicker, false),
+        effectHash(Shimmer::Effect::Flicker, false, 1));
+}
+
+void test_end_lockup()
+{
+    Shimmer shimmer;
+    shimmer.lockup();
+    shimmer.endLockup();
+    TEST_ASSERT_EQUAL_HEX32(effectHash(Shimmer::Effect::Flicker, false), frameHash(shimmer, false));
+}
+
+void test_flicker_stays_near_base()
+{
+    Shimmer shimmer;
+    uint8_t frame[PIXELS * 3];
+    for (uint16_t index = 0; index < FRAMES; ++index) {
+        shimmer.render(0x0, 0x0, 0xff, frame, PIXELS);
+        for (uint16_t pixel = 0; pixel < PIXELS; ++pixel) {
+            TEST_ASSERT_EQUAL_UINT8(0, frame[pixel * 3]);
+            TEST_ASSERT_TRUE(frame[pixel * 3 + 2] >= 0xc0);
+        }
+    }
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_flicker_golden);
+    RUN_TEST(test_unstable_golden);
+    RUN_TEST(test_lockup_golden);
+    RUN_TEST(test_reseed_restarts);
+    RUN_TEST(test_other_seed_differs);
+    RUN_TEST(test_end_lockup);
+    RUN_TEST(test_flicker_stays_near_base);
+    return UNITY_END();
+}
@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+"""Regenerate test/test_delta/delta_fixture.h: a small base and target image
+and the delta tools/ota.py builds for them.
+
+  tools/delta_fixture.py > test/test_delta/delta_fixture.h
+"""
+
+import os
+import random
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from ota import apply_delta, make_delta  # noqa: E402
+
+
+def array(name, data):
+    lines = ["static const uint8_t %s[] = {" % name]
+    for offset in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % byte for byte in data[offset:offset + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    generator = random.Random(26)
+    base = bytes([0xe9]) + bytes(generator.randrange(256) for _ in range(1279))
+    target = bytearray(base)
+    target[2] = 0x02  # patched flash mode
+    target[300:300] = b"inserted literal data"
+    target[500:500] = base[:64]  # must not be copied from the image header
+    target[700:760] = bytes(60)
+    del target[1000:1040]
+    target += bytes(generator.randrange(256) for _ in range(100))
+    target = bytes(target)
+
+    delta = make_delta(base, target)
+    assert apply_delta(base, delta)[0] == target
+
+    print("#pragma once")
+    print("// generated by tools/delta_fixture.py, do not edit")
+    print("#include <stdint.h>")
+    print()
+    print(array("fixture_base", base))
+    print()
+    print(array("fixture_target", target))
+    print()
+    print(array("fixture_delta", delta))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,83 @@
+"""PlatformIO post build script: static RAM/flash per module and budget check.
+
+Budgets are read from platformio.ini:
+
+  custom_ram_budget   = bytes of .data + .rodata + .bss (what is left is heap)
+  custom_flash_budget = bytes of code and constants in flash
+
+The build fails when the firmware exceeds one of them.
+"""
+
+import os
+import re
+import subprocess
+
+Import("env")  # noqa: F821
+
+RAM_SECTIONS = (".data", ".rodata", ".bss")
+FLASH_SECTIONS = (".irom0.text", ".text", ".data", ".rodata")
+
+
+def sections(path):
+    sizes = {}
+    output = subprocess.check_output([env.subst("$SIZETOOL"), "-A", path]).decode()
+    for line in output.splitlines():
+        fields = line.split()
+        if len(fields) >= 2 and fields[0].startswith(".") and fields[1].isdigit():
+            sizes[fields[0]] = sizes.get(fields[0], 0) + int(fields[1])
+    return sizes
+
+
+def object_sizes(path):
+    # text/data/bss per object, works for .o and archives alike
+    total = [0, 0, 0]
+    output = subprocess.check_output([env.subst("$SIZETOOL"), "-B", path]).decode()
+    for line in output.splitlines()[1:]:
+        fields = line.split()
+        if len(fields) >= 3 and all(field.isdigit() for field in fields[:3]):
+            for index in range(3):
+                total[index] += int(fields[index])
+    return total
+
+
+def modules(build_dir):
+    # project sources as single objects, libraries and the framework as archives
+    found = []
+    src_dir = os.path.join(build_dir, "src")
+    for root, _, files in os.walk(build_dir):
+        for name in sorted(files):
+            if name.endswith(".o") and root == src_dir:
+                found.append((name[:-2], os.path.join(root, name)))
+            elif name.endswith(".a"):
+                found.append((re.sub(r"^lib|\.a$", "", name), os.path.join(root, name)))
+    return found
+
+
+def budget(name, default):
+    return int(env.GetProjectOption(name, default))
+
+
+def check(source, target, env):
+    elf = str(target[0])
+    build_dir = env.subst("$BUILD_DIR")
+
+    print("Memory per module (text / data / bss):")
+    for name, path in modules(build_dir):
+        text, data, bss = object_sizes(path)
+        print("  %-24s %7u %6u %6u" % (name, text, data, bss))
+
+    sizes = sections(elf)
+    ram = sum(sizes.get(name, 0) for name in RAM_SECTIONS)
+    flash = sum(sizes.get(name, 0) for name in FLASH_SECTIONS)
+    ram_budget = budget("custom_ram_budget", 40960)
+    flash_budget = budget("custom_flash_budget", 1044464)
+
+    print("RAM:   %7u of %7u bytes budget" % (ram, ram_budget))
+    print("Flash: %7u of %7u bytes budget" % (flash, flash_budget))
+
+    if ram > ram_budget or flash > flash_budget:
+        print("Error: memory budget exceeded")
+        env.Exit(1)
+
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", check)
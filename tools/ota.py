@@ -0,0 +1,269 @@
+#!/usr/bin/env python3
+"""Build and push compressed or delta firmware images for the HTTP update
+in OTA mode (see src/firmware_update.h).
+
+  ota.py gzip  NEW.bin OUT.bin.gz
+  ota.py delta BASE.bin NEW.bin OUT.delta
+  ota.py push  HOST IMAGE
+  ota.py serve BASE.bin [--port 8080] [--out received.bin]
+
+BASE.bin must be the image currently running on the blade, usually a copy of
+.pio/build/esp12e/firmware.bin kept from the last upload. `serve` is a local
+stand-in for the blade: it accepts the same uploads, applies them against
+BASE.bin and reports the same metrics.
+
+Delta format, little endian:
+  "LSD1" | source size u32 | target size u32 | source md5 (16 bytes)
+         | target md5 (16 bytes)
+  the source md5 skips the first HEADER_LITERAL bytes of the source image
+  ops:  'C' offset u32 length u32   copy from the running firmware
+        'I' length u32 data          insert literal data
+        'E'                          end
+"""
+
+import argparse
+import gzip
+import hashlib
+import http.server
+import struct
+import sys
+import time
+import urllib.error
+import urllib.request
+import uuid
+
+MAGIC = b"LSD1"
+BLOCK = 16
+# a copy op costs 9 bytes, below that inserting is cheaper
+MIN_COPY = 24
+# image header (flash mode/size) may be patched by the uploader, never copy it
+HEADER_LITERAL = 16
+
+
+def make_delta(base, target):
+    index = {}
+    for offset in range(HEADER_LITERAL, len(base) - BLOCK + 1):
+        index.setdefault(base[offset:offset + BLOCK], offset)
+
+    ops = []
+    literal = bytearray(target[:HEADER_LITERAL])
+    pos = len(literal)
+    while pos < len(target):
+        offset = index.get(target[pos:pos + BLOCK])
+        if offset is not None:
+            length = BLOCK
+            while (pos + length < len(target)
+                   and offset + length < len(base)
+                   and target[pos + length] == base[offset + length]):
+                length += 1
+            if length >= MIN_COPY:
+                if literal:
+                    ops.append((b"I", bytes(literal)))
+                    literal = bytearray()
+                ops.append((b"C", offset, length))
+                pos += length
+                continue
+        literal.append(target[pos])
+        pos += 1
+    if literal:
+        ops.append((b"I", bytes(literal)))
+
+    out = bytearray(MAGIC)
+    out += struct.pack("<II", len(base), len(target))
+    out += hashlib.md5(base[HEADER_LITERAL:]).digest()
+    out += hashlib.md5(target).digest()
+    for op in ops:
+        if op[0] == b"C":
+            out += b"C" + struct.pack("<II", op[1], op[2])
+        else:
+            out += b"I" + struct.pack("<I", len(op[1])) + op[1]
+    out += b"E"
+    return bytes(out)
+
+
+def apply_delta(base, delta):
+    if delta[:4] != MAGIC:
+        raise ValueError("not a delta image")
+    source_size, target_size = struct.unpack_from("<II", delta, 4)
+    if source_size != len(base) or delta[12:28] != hashlib.md5(base[HEADER_LITERAL:]).digest():
+        raise ValueError("delta base does not match running firmware")
+    md5 = delta[28:44]
+    pos = 44
+    out = bytearray()
+    copied = 0
+    while True:
+        op = delta[pos:pos + 1]
+        pos += 1
+        if op == b"C":
+            offset, length = struct.unpack_from("<II", delta, pos)
+            pos += 8
+            if offset < HEADER_LITERAL or offset + length > len(base):
+                raise ValueError("delta copies beyond running firmware")
+            out += base[offset:offset + length]
+            copied += length
+        elif op == b"I":
+            (length,) = struct.unpack_from("<I", delta, pos)
+            pos += 4
+            out += delta[pos:pos + length]
+            pos += length
+        elif op == b"E":
+            break
+        else:
+            raise ValueError("bad delta op")
+    if pos != len(delta):
+        raise ValueError("unexpected data after delta end")
+    if len(out) != target_size or hashlib.md5(out).digest() != md5:
+        raise ValueError("MD5 Check Failed")
+    return bytes(out), copied
+
+
+def kind_of(data):
+    if data[:4] == MAGIC:
+        return "delta"
+    if data[:2] == b"\x1f\x8b":
+        return "gzip"
+    if data[:1] == b"\xe9":
+        return "image"
+    return "unknown"
+
+
+def report(kind, payload, flash, copied, ms):
+    # same as the blade: the file part only, `push` reports the bytes on wire
+    kbps = (payload * 8) // ms if ms else 0
+    return ("kind: %s\npayload: %u bytes\nflash: %u bytes (%u copied from running firmware)\n"
+            "time: %u ms (%u kbit/s payload)\n" % (kind, payload, flash, copied, ms, kbps))
+
+
+def multipart(filename, data):
+    boundary = uuid.uuid4().hex
+    body = (("--%s\r\nContent-Disposition: form-data; name=\"firmware\"; filename=\"%s\"\r\n"
+             "Content-Type: application/octet-stream\r\n\r\n") % (boundary, filename)).encode()
+    body += data + ("\r\n--%s--\r\n" % boundary).encode()
+    return boundary, body
+
+
+def parse_multipart(content_type, body):
+    boundary = content_type.split("boundary=", 1)[1].strip('"').encode()
+    for part in body.split(b"--" + boundary):
+        head, sep, payload = part.partition(b"\r\n\r\n")
+        if sep and b"filename=" in head:
+            return payload[:-2] if payload.endswith(b"\r\n") else payload
+    raise ValueError("no file in upload")
+
+
+def cmd_gzip(args):
+    data = open(args.new, "rb").read()
+    packed = gzip.compress(data, 9)
+    open(args.out, "wb").write(packed)
+    print("%s: %u -> %u bytes (%.1f%%)" % (args.out, len(data), len(packed), 100.0 * len(packed) / len(data)))
+
+
+def cmd_delta(args):
+    base = open(args.base, "rb").read()
+    new = open(args.new, "rb").read()
+    delta = make_delta(base, new)
+    assert apply_delta(base, delta)[0] == new
+    open(args.out, "wb").write(delta)
+    print("%s: %u -> %u bytes (%.1f%%)" % (args.out, len(new), len(delta), 100.0 * len(delta) / len(new)))
+
+
+def cmd_push(args):
+    data = open(args.image, "rb").read()
+    boundary, body = multipart(args.image.split("/")[-1], data)
+    url = args.host if args.host.startswith("http") else "http://%s/update" % args.host
+    request = urllib.request.Request(url, data=body, method="POST")
+    request.add_header("Content-Type", "multipart/form-data; boundary=%s" % boundary)
+    start = time.monotonic()
+    try:
+        with urllib.request.urlopen(request, timeout=120) as response:
+            answer = response.read().decode()
+            ok = True
+    except urllib.error.HTTPError as error:
+        answer = error.read().decode()
+        ok = False
+    ms = int((time.monotonic() - start) * 1000)
+    print(answer, end="")
+    print("host: %u bytes on wire (%u payload) in %u ms" % (len(body), len(data), ms))
+    return 0 if ok else 1
+
+
+def cmd_serve(args):
+    base = open(args.base, "rb").read()
+
+    class Handler(http.server.BaseHTTPRequestHandler):
+        def do_POST(self):
+            if self.path != "/update":
+                self.send_error(404)
+                return
+            start = time.monotonic()
+            body = self.rfile.read(int(self.headers["Content-Length"]))
+            data = parse_multipart(self.headers["Content-Type"], body)
+            kind = kind_of(data)
+            copied = 0
+            try:
+                if kind == "delta":
+                    image, copied = apply_delta(base, data)
+                    flash = len(image)
+                elif kind == "gzip":
+                    image = gzip.decompress(data)
+                    flash = len(data)
+                elif kind == "image":
+                    image = data
+                    flash = len(data)
+                else:
+                    raise ValueError("unknown image format")
+                error = None
+            except (ValueError, OSError) as exc:
+                error = str(exc)
+                flash = 0
+            ms = int((time.monotonic() - start) * 1000)
+            text = report(kind, len(data), flash, copied, ms)
+            if error:
+                self.send_response(500)
+                text = "FAIL %s\n%s" % (error, text)
+            else:
+                open(args.out, "wb").write(image)
+                self.send_response(200)
+                text = "OK\n" + text
+            self.send_header("Content-Type", "text/plain")
+            self.end_headers()
+            self.wfile.write(text.encode())
+            sys.stdout.write(text)
+
+    server = http.server.HTTPServer(("", args.port), Handler)
+    print("stand-in blade: POST http://localhost:%u/update" % args.port)
+    server.serve_forever()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    p = sub.add_parser("gzip")
+    p.add_argument("new")
+    p.add_argument("out")
+    p.set_defaults(func=cmd_gzip)
+
+    p = sub.add_parser("delta")
+    p.add_argument("base")
+    p.add_argument("new")
+    p.add_argument("out")
+    p.set_defaults(func=cmd_delta)
+
+    p = sub.add_parser("push")
+    p.add_argument("host")
+    p.add_argument("image")
+    p.set_defaults(func=cmd_push)
+
+    p = sub.add_parser("serve")
+    p.add_argument("base")
+    p.add_argument("--port", type=int, default=8080)
+    p.add_argument("--out", default="received.bin")
+    p.set_defaults(func=cmd_serve)
+
+    args = parser.parse_args()
+    return args.func(args) or 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())